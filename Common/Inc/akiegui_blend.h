@@ -0,0 +1,142 @@
+/* ============= akiegui_blend.h ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 颜色混合部分
+ *
+ * 全部使用定点整数运算：
+ *   - RGB565：拆成 G____R____B 间隔排列，一次乘法混合三个通道；
+ *             两个像素拼成一个32位字时用两次乘法混合两个像素（SWAR）
+ *   - ARGB8888：R、B 两通道一起算，G 单独算
+ *   - 除以255使用 (x+128)*257>>16
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#ifndef __AKIEGUI_BLEND_H__
+#define __AKIEGUI_BLEND_H__
+
+#include "akiegui_color.h"
+#include <stdint.h>
+
+/* 透明度 */
+#define AKIEGUI_OPA_TRANSP  0
+#define AKIEGUI_OPA_COVER   255
+
+/* ===== RGB565 ===== */
+
+/**
+ * @brief RGB565 混合，alpha 0~255
+ */
+static inline uint16_t akiegui_blend_rgb565(uint16_t bg, uint16_t fg, uint8_t alpha) {
+    uint32_t a = ((uint32_t)alpha + 4) >> 3;    /* 0~32 */
+    uint32_t f = (fg | ((uint32_t)fg << 16)) & 0x07E0F81Fu;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81Fu;
+    uint32_t r = ((f * a + b * (32 - a)) >> 5) & 0x07E0F81Fu;
+    return (uint16_t)(r | (r >> 16));
+}
+
+/**
+ * @brief RGB565 两像素混合（SWAR）
+ * @param bg2: 两个背景像素（同一个32位字）
+ * @param fg: 前景颜色
+ * @param alpha: 0~255
+ * @note  像素0的R/B与像素1的G共用一个字，像素0的G与像素1的R/B右移5位后共用另一个字，
+ *        各字段之间留有足够的空位，乘以32不会进位到相邻字段
+ */
+static inline uint32_t akiegui_blend_rgb565_x2(uint32_t bg2, uint16_t fg, uint8_t alpha) {
+    uint32_t a = ((uint32_t)alpha + 4) >> 3;
+    uint32_t fg2 = fg | ((uint32_t)fg << 16);
+    uint32_t f1 = fg2 & 0x07E0F81Fu;
+    uint32_t b1 = bg2 & 0x07E0F81Fu;
+    uint32_t f2 = (fg2 >> 5) & 0x07C0F83Fu;
+    uint32_t b2 = (bg2 >> 5) & 0x07C0F83Fu;
+    uint32_t r1 = ((f1 * a + b1 * (32 - a)) >> 5) & 0x07E0F81Fu;
+    uint32_t r2 = ((f2 * a + b2 * (32 - a)) >> 5) & 0x07C0F83Fu;
+    return r1 | (r2 << 5);
+}
+
+/**
+ * @brief RGB565 预乘混合：fg 已乘过 alpha（各通道向下取整），只需衰减背景
+ * @note  背景系数按 alpha 向上取整后取反，保证两项相加不会溢出到相邻通道
+ */
+static inline uint16_t akiegui_blend_rgb565_premul(uint16_t bg, uint16_t fg_premul, uint8_t alpha) {
+    uint32_t ia = 32 - ((uint32_t)alpha * 32 + 254) / 255;
+    uint32_t b = (bg | ((uint32_t)bg << 16)) & 0x07E0F81Fu;
+    b = ((b * ia) >> 5) & 0x07E0F81Fu;
+    return (uint16_t)(fg_premul + (b | (b >> 16)));
+}
+
+/* ===== ARGB8888 ===== */
+
+/**
+ * @brief ARGB8888 混合，alpha 0~255，结果保留背景的 A 通道
+ */
+static inline uint32_t akiegui_blend_argb8888(uint32_t bg, uint32_t fg, uint8_t alpha) {
+    uint32_t a = (uint32_t)alpha + (alpha >> 7);    /* 0~256 */
+    uint32_t rb = (((fg & 0x00FF00FFu) * a + (bg & 0x00FF00FFu) * (256 - a)) >> 8) & 0x00FF00FFu;
+    uint32_t g  = (((fg & 0x0000FF00u) * a + (bg & 0x0000FF00u) * (256 - a)) >> 8) & 0x0000FF00u;
+    return (bg & 0xFF000000u) | rb | g;
+}
+
+/**
+ * @brief ARGB8888 预乘混合：src 的 RGB 已乘过自身 A（向下取整）
+ * @note  背景乘 (255-A)/256，两项都向下取整，相加不会溢出
+ */
+static inline uint32_t akiegui_blend_argb8888_premul(uint32_t bg, uint32_t src_premul) {
+    uint32_t ia = 255 - (src_premul >> 24);
+    uint32_t rb = (((bg & 0x00FF00FFu) * ia) >> 8) & 0x00FF00FFu;
+    uint32_t g  = (((bg & 0x0000FF00u) * ia) >> 8) & 0x0000FF00u;
+    return (bg & 0xFF000000u) + (src_premul & 0x00FFFFFFu) + rb + g;
+}
+
+/**
+ * @brief ARGB8888 转预乘格式（x*a*257>>16，向下取整）
+ */
+static inline uint32_t akiegui_argb8888_premultiply(uint32_t argb) {
+    uint32_t a = argb >> 24;
+    uint32_t r = (((argb >> 16) & 0xFF) * a * 257) >> 16;
+    uint32_t g = (((argb >> 8) & 0xFF) * a * 257) >> 16;
+    uint32_t b = ((argb & 0xFF) * a * 257) >> 16;
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+/* ===== 本地颜色格式 ===== */
+
+/**
+ * @brief 按当前 BPP 混合两个本地颜色
+ */
+static inline akiegui_color_t akiegui_blend(akiegui_color_t bg, akiegui_color_t fg, uint8_t alpha) {
+#if AkieGUI_LCD_BPP == 16
+    return akiegui_blend_rgb565(bg, fg, alpha);
+#else
+    return akiegui_blend_argb8888(bg, fg, alpha);
+#endif
+}
+
+/**
+ * @brief 把带 alpha 的 ARGB8888 颜色再乘上整体透明度，混合到本地颜色上
+ */
+static inline akiegui_color_t akiegui_blend_argb(akiegui_color_t bg, uint32_t argb, uint8_t opa) {
+    uint32_t a = argb >> 24;
+    if (opa != AKIEGUI_OPA_COVER) a = AKIEGUI_DIV255(a * opa);
+    if (a == 0) return bg;
+    akiegui_color_t fg = akiegui_argb888_to_native(argb | 0xFF000000u);
+    if (a == 0xFF) return fg;
+    return akiegui_blend(bg, fg, (uint8_t)a);
+}
+
+/* ===== 批量混合 ===== */
+
+/* 单色、固定透明度混合一段连续像素 */
+void akiegui_blend_span(void *dst, uint32_t count, akiegui_color_t color, uint8_t opa);
+
+/* ARGB8888 源像素（逐像素 alpha）乘整体透明度后混合到一段连续像素 */
+void akiegui_blend_span_argb(void *dst, const uint32_t *src, uint32_t count, uint8_t opa);
+
+/* 预乘 ARGB8888 源像素混合到一段连续像素 */
+void akiegui_blend_span_premul(void *dst, const uint32_t *src, uint32_t count);
+
+#endif
@@ -0,0 +1,118 @@
+/* ============= akiegui_blit.h ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 像素块搬运部分
+ *
+ * 把一块像素从源缓冲区复制到目标缓冲区：
+ *   - 源、目标各自有格式和行跨度（stride）
+ *   - 同格式按行 memcpy，不同格式查转换矩阵（常用组合有专用/SIMD内核）
+ *   - 支持直接复制、关键色透明、按 alpha 混合、预乘 alpha 混合
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#ifndef __AKIEGUI_BLIT_H__
+#define __AKIEGUI_BLIT_H__
+
+#include "akiegui_core.h"
+#include "akiegui_color.h"
+#include <stdint.h>
+
+/* ============= 像素格式 ============= */
+#define AKIEGUI_FMT_RGB565        0     /* uint16_t，本机字节序 */
+#define AKIEGUI_FMT_RGB888        1     /* R,G,B 三字节 */
+#define AKIEGUI_FMT_ARGB8888      2     /* uint32_t 0xAARRGGBB，本机字节序 */
+#define AKIEGUI_FMT_ARGB8888_BE   3     /* A,R,G,B 四字节（图片控件的数据格式）*/
+#define AKIEGUI_FMT_L8            4     /* 8位灰度 */
+#define AKIEGUI_FMT_COUNT         5
+
+/* 帧缓冲的格式 */
+#if AkieGUI_LCD_BPP == 16
+#define AKIEGUI_FMT_NATIVE        AKIEGUI_FMT_RGB565
+#else
+#define AKIEGUI_FMT_NATIVE        AKIEGUI_FMT_ARGB8888
+#endif
+
+/* ============= 搬运模式 ============= */
+#define AKIEGUI_BLIT_COPY         0     /* 直接复制（必要时转换格式）*/
+#define AKIEGUI_BLIT_COLORKEY     1     /* 等于关键色的源像素不复制 */
+#define AKIEGUI_BLIT_ALPHA        2     /* 按源像素 alpha 混合 */
+#define AKIEGUI_BLIT_PREMUL       3     /* 源像素为预乘 alpha，按预乘方式混合 */
+
+/* ============= 像素缓冲区 ============= */
+typedef struct {
+    void *data;         /* 第一行第一个像素 */
+    uint16_t w;         /* 宽度（像素）*/
+    uint16_t h;         /* 高度（像素）*/
+    uint32_t stride;    /* 每行字节数，0=按宽度紧密排列 */
+    uint8_t format;     /* AKIEGUI_FMT_xxx */
+} AkieGUI_Surface_T;
+
+/**
+ * @brief 像素格式的每像素字节数
+ */
+static inline uint8_t akiegui_fmt_bytes(uint8_t format) {
+    static const uint8_t bytes[AKIEGUI_FMT_COUNT] = { 2, 3, 4, 4, 1 };
+    return (format < AKIEGUI_FMT_COUNT) ? bytes[format] : 0;
+}
+
+/**
+ * @brief 用一块内存初始化缓冲区描述
+ */
+static inline void akiegui_surface_init(AkieGUI_Surface_T *s, void *data,
+                                        uint16_t w, uint16_t h, uint8_t format) {
+    s->data = data;
+    s->w = w;
+    s->h = h;
+    s->format = format;
+    s->stride = (uint32_t)w * akiegui_fmt_bytes(format);
+}
+
+/* 通用搬运：src 的 src_area 区域（NULL=整个）复制到 dst 的 (x, y)，只按 dst 边界裁剪
+ * key 为源格式的原始像素值（只在 AKIEGUI_BLIT_COLORKEY 时使用）
+ * 返回 0成功 -1参数错误 */
+int akiegui_blit(
+    AkieGUI_Surface_T *dst,
+    int16_t x, int16_t y,
+    const AkieGUI_Surface_T *src,
+    const AkieGUI_Rect_T *src_area,
+    uint8_t mode,
+    uint8_t opa,
+    uint32_t key
+);
+
+/* 只用CPU搬运，不经过加速器（参数同 akiegui_blit，供加速器的软件实现使用）*/
+int akiegui_blit_cpu(
+    AkieGUI_Surface_T *dst,
+    int16_t x, int16_t y,
+    const AkieGUI_Surface_T *src,
+    const AkieGUI_Rect_T *src_area,
+    uint8_t mode,
+    uint8_t opa,
+    uint32_t key
+);
+
+/* 搬运到帧缓冲：按当前裁剪区裁剪，并乘以绘制透明度 */
+void akiegui_draw_blit(
+    void *fb,
+    int16_t x, int16_t y,
+    const AkieGUI_Surface_T *src,
+    const AkieGUI_Rect_T *src_area,
+    uint8_t mode,
+    uint32_t key
+);
+
+/* 缩放搬运到帧缓冲（最近邻，16.16定点步进），整个 src 缩放到 w×h */
+void akiegui_draw_blit_scaled(
+    void *fb,
+    int16_t x, int16_t y,
+    uint16_t w, uint16_t h,
+    const AkieGUI_Surface_T *src,
+    uint8_t mode,
+    uint32_t key
+);
+
+#endif
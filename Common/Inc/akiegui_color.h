@@ -60,24 +60,20 @@ static inline uint32_t akiegui_native_to_argb888(akiegui_color_t color) {
 #endif
 }
 
+/* 定点除以255（四舍五入），x 不超过 255*255 */
+#define AKIEGUI_DIV255(x)   (((((uint32_t)(x)) + 128) * 257) >> 16)
+
 static inline uint32_t alpha_blend(uint32_t bg, uint32_t fg) {
-    uint8_t a = (fg >> 24) & 0xFF;
+    uint32_t a = (fg >> 24) & 0xFF;
     if (a == 0xFF) return fg;
     if (a == 0x00) return bg;
 
-    uint8_t bg_r = (bg >> 16) & 0xFF;
-    uint8_t bg_g = (bg >> 8) & 0xFF;
-    uint8_t bg_b = bg & 0xFF;
-
-    uint8_t fg_r = (fg >> 16) & 0xFF;
-    uint8_t fg_g = (fg >> 8) & 0xFF;
-    uint8_t fg_b = fg & 0xFF;
-
-    uint8_t r = (fg_r * a + bg_r * (255 - a)) / 255;
-    uint8_t g = (fg_g * a + bg_g * (255 - a)) / 255;
-    uint8_t b = (fg_b * a + bg_b * (255 - a)) / 255;
+    uint32_t ia = 255 - a;
+    uint32_t r = AKIEGUI_DIV255(((fg >> 16) & 0xFF) * a + ((bg >> 16) & 0xFF) * ia);
+    uint32_t g = AKIEGUI_DIV255(((fg >> 8) & 0xFF) * a + ((bg >> 8) & 0xFF) * ia);
+    uint32_t b = AKIEGUI_DIV255((fg & 0xFF) * a + (bg & 0xFF) * ia);
 
-    return (0xFF << 24) | (r << 16) | (g << 8) | b;
+    return (0xFFu << 24) | (r << 16) | (g << 8) | b;
 }
 
 /* 预定义颜色（RGB888 格式）*/
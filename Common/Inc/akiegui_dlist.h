@@ -0,0 +1,71 @@
+/* ============= akiegui_dlist.h ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 显示列表部分
+ *
+ * 一帧要分成几块区域（脏矩形、条带）提交时，控件的绘制函数只调用一次：
+ *   - 录制：g_akiegui.dl 不为NULL时，矩形、字形串、图片搬运、渐变不写显存，
+ *     按当时的裁剪区裁好后，连同包围盒追加到命令缓冲区
+ *   - 回放：对每块区域，只执行包围盒与当前裁剪区相交的命令
+ *   - 缓冲区放不下时置 overflow，调用者改为直接绘制
+ *
+ * 注意：从录制到回放结束，图片数据不能修改（命令里只保存指针）
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#ifndef __AKIEGUI_DLIST_H__
+#define __AKIEGUI_DLIST_H__
+
+#include "akiegui_core.h"
+#include "akiegui_color.h"
+#include "akiegui_blit.h"
+#include <stdint.h>
+
+/* ============= 显示列表 ============= */
+struct AkieGUI_DList_S {
+    void *buf;              /* 命令缓冲区（按指针对齐）*/
+    uint32_t size;          /* 缓冲区字节数 */
+    uint32_t used;          /* 已用字节数 */
+    uint32_t run;           /* 可以续接字形的字形串命令偏移，0xFFFFFFFF=没有 */
+    uint8_t overflow;       /* 1=放不下，录制结果不完整 */
+};
+
+/* 用一块内存初始化显示列表 */
+void akiegui_dl_init(AkieGUI_DList_T *dl, void *buf, uint32_t size);
+
+/* 清空并开始录制（之后的绘制都进入 dl），结束录制 */
+void akiegui_dl_begin(AkieGUI_DList_T *dl);
+void akiegui_dl_end(void);
+
+/* 当前录制位置，用于划分每个控件的命令范围 */
+uint32_t akiegui_dl_mark(AkieGUI_DList_T *dl);
+
+/* 回放 [from, to) 范围内的命令，只画当前裁剪区内的部分 */
+void akiegui_dl_replay(const AkieGUI_DList_T *dl, void *fb, uint32_t from, uint32_t to);
+
+/* ============= 录制入口（由绘制函数调用，按当前裁剪区裁剪）============= */
+
+/* 已裁剪的单色矩形 */
+void akiegui_dl_rect(int32_t x, int32_t y, int32_t w, int32_t h,
+                     akiegui_color_t color, uint8_t opa);
+
+/* 一个字模；与上一个字模同一行、紧挨着且参数相同时并入同一字形串 */
+void akiegui_dl_glyph(int32_t x, int32_t y, const uint8_t *data,
+                      uint16_t width, uint16_t height, uint8_t bpp,
+                      akiegui_color_t color, akiegui_color_t bg_color, uint8_t transparent);
+
+/* 图片搬运：w/h 为缩放后的大小，0表示不缩放 */
+void akiegui_dl_blit(int16_t x, int16_t y, uint16_t w, uint16_t h,
+                     const AkieGUI_Surface_T *src, const AkieGUI_Rect_T *src_area,
+                     uint8_t mode, uint32_t key);
+
+/* 渐变：radial=0 为线性（dir 有效），1 为径向（cx/cy/r 有效）*/
+void akiegui_dl_gradient(uint8_t radial, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                         int16_t cx, int16_t cy, uint16_t r,
+                         uint32_t c0, uint32_t c1, uint8_t dir);
+
+#endif
@@ -16,6 +16,23 @@
 #include "akiegui_color.h"
 #include "akiegui_font_ascii.h"
 
+/* 圆半宽表缓存的最大半径（超过时逐行开方，不超过255）*/
+#ifndef AkieGUI_CIRCLE_CACHE_RADIUS
+#define AkieGUI_CIRCLE_CACHE_RADIUS  64
+#endif
+
+/* 裁剪栈：所有绘制函数只写入栈顶裁剪区内的像素 */
+int  akiegui_clip_push(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void akiegui_clip_pop(void);
+void akiegui_clip_reset(void);
+void akiegui_clip_get(AkieGUI_Rect_T *out);
+
+/* 绘制透明度：之后的矩形、文字按此透明度混合（255=不透明，默认） */
+void akiegui_set_opa(uint8_t opa);
+
+/* 连续像素填充（整字/SIMD写入） */
+void akiegui_fill_span(void *dst, uint32_t count, akiegui_color_t color);
+
 /* 绘制矩形 */
 void akiegui_draw_rect(
     void *fb,
@@ -24,6 +41,53 @@ void akiegui_draw_rect(
     akiegui_color_t color
 );
 
+/* 绘制半透明矩形 */
+void akiegui_draw_rect_opa(
+    void *fb,
+    uint16_t x, uint16_t y,
+    uint16_t w, uint16_t h,
+    akiegui_color_t color,
+    uint8_t opa
+);
+
+/* 水平线、竖直线 */
+void akiegui_draw_hline(void *fb, int16_t x, int16_t y, uint16_t w, akiegui_color_t color);
+void akiegui_draw_vline(void *fb, int16_t x, int16_t y, uint16_t h, akiegui_color_t color);
+
+/* 直线（Bresenham）*/
+void akiegui_draw_line(void *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, akiegui_color_t color);
+
+/* 圆（描边/实心）*/
+void akiegui_draw_circle(void *fb, int16_t cx, int16_t cy, uint16_t r, akiegui_color_t color);
+void akiegui_fill_circle(void *fb, int16_t cx, int16_t cy, uint16_t r, akiegui_color_t color);
+
+/* 圆弧：0°在右侧，顺时针；起止角相同时画整个圆环 */
+void akiegui_draw_arc(
+    void *fb,
+    int16_t cx, int16_t cy,
+    uint16_t r, uint16_t width,
+    uint16_t start_angle, uint16_t end_angle,
+    akiegui_color_t color
+);
+
+/* 圆角矩形（描边/实心）*/
+void akiegui_draw_round_rect(void *fb, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                             uint16_t r, akiegui_color_t color);
+void akiegui_fill_round_rect(void *fb, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                             uint16_t r, akiegui_color_t color);
+
+/* 绘制字模位图（bpp=1/2/4，数据格式同字库）*/
+void akiegui_draw_glyph(
+    void *fb,
+    int16_t x, int16_t y,
+    const uint8_t *data,
+    uint16_t width, uint16_t height,
+    uint8_t bpp,
+    akiegui_color_t color,
+    akiegui_color_t bg_color,
+    uint8_t transparent
+);
+
 /* 绘制字符 */
 void akiegui_draw_char(
     void *fb,
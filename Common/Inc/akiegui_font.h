@@ -11,12 +11,21 @@
  */
 #pragma once
 #include <stdint.h>
+#include <stddef.h>
 
 // !"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\]^_`abcdefghijklmnopqrstuvwxyz{|}~
 //↑这里有空格
 
-#define FONT_TYPE_ASCII 437
-#define FONT_TYPE_GBK   936
+#define FONT_TYPE_ASCII  437
+#define FONT_TYPE_GBK    936      //  字模行与编码行交替排列的汉字字库
+#define FONT_TYPE_GB2312 20936    //  完整GB2312字库：只有字模，按区位码(0xA1A1起，每区94字)顺序排列
+
+/* 汉字编码索引项：按编码升序排列，用于二分查找 */
+typedef struct
+{
+    uint16_t            Code;           //  GB2312编码（高字节在前）
+    uint16_t            Glyph;          //  字模在pTable中的序号
+} pFONT_INDEX;
 
 typedef struct _pFont
 {    
@@ -26,4 +35,13 @@ typedef struct _pFont
 	uint16_t 			Sizes;	 		//  单个字符的字模数据个数
 	uint16_t			Table_Rows;		//  该参数只有汉字字模用到，表示二维数组的行大小
     uint16_t            FontType;       //  字体标识符
-} pFONT;
\ No newline at end of file
+    const pFONT_INDEX   *pIndex;        //  汉字编码索引（可在字库文件中静态给出，为NULL时首次查找自动生成）
+    uint16_t            Index_Count;    //  索引项个数
+    uint8_t             Bpp;            //  每像素位数：0/1=单色点阵，2/4=抗锯齿灰度（逐行式，高位在前）
+} pFONT;
+
+/* 生成汉字编码索引（从内存池分配）*/
+int akiegui_font_build_index(pFONT *font);
+
+/* 查找GB2312字符的字模，字库中没有该字返回NULL */
+const uint8_t* akiegui_font_find_glyph(pFONT *font, const char *ch);
\ No newline at end of file
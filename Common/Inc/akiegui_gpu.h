@@ -0,0 +1,77 @@
+/* ============= akiegui_gpu.h ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 2D加速器调度部分
+ *
+ * 绘制层把大块的填充、复制、混合、格式转换交给 g_akiegui.gpu 操作表（DMA2D、PXP等），
+ * 加速器异步执行，CPU 继续绘制其他内容：
+ *   - 提交时记录目标缓冲区和包围盒
+ *   - CPU 要写的区域与未完成的操作重叠时才等待
+ *   - 提交屏幕、交换缓冲区前等待全部完成
+ *   - 加速器拒绝的操作由软件完成
+ *
+ * 注意：源数据在操作完成前不能修改；CPU 直接写同一块显存的其他视图（不同起始地址）时不做重叠检查
+ *
+ * 附带一个软件参考实现 AkieGUI_GPU_SoftOps：操作先进队列，
+ * 调用 akiegui_gpu_soft_process() 或 CPU 等待时才执行，与真实加速器的异步行为一致
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#ifndef __AKIEGUI_GPU_H__
+#define __AKIEGUI_GPU_H__
+
+#include "akiegui_core.h"
+
+/* 小于这个像素数的操作直接用CPU画，省掉提交开销 */
+#ifndef AkieGUI_GPU_MIN_PIXELS
+#define AkieGUI_GPU_MIN_PIXELS  256
+#endif
+
+/* 软件参考实现的队列深度 */
+#ifndef AkieGUI_GPU_SOFT_QUEUE
+#define AkieGUI_GPU_SOFT_QUEUE  8
+#endif
+
+/**
+ * @brief 设置加速器操作表（NULL=关闭），切换前等待已提交的操作完成
+ */
+void AkieGUI_GPU_SetOps(const AkieGUI_GPU_Ops_T *ops);
+
+/**
+ * @brief CPU 写 base 上的 (x, y, w, h) 之前调用：与未完成的加速器操作、还没发完的屏幕传输重叠时等待
+ */
+static inline void akiegui_gpu_wait_rect(const void *base, int32_t x, int32_t y, int32_t w, int32_t h) {
+    AkieGUI_Xfer_WaitRect(base, x, y, w, h);
+    if (g_akiegui.gpu_completed == g_akiegui.gpu_submitted) return;
+    if (base != g_akiegui.gpu_base) return;
+    const AkieGUI_Rect_T *b = &g_akiegui.gpu_dirty;
+    if (x >= b->x + b->w || y >= b->y + b->h || x + w <= b->x || y + h <= b->y) return;
+    AkieGUI_GPU_Sync();
+}
+
+/* 提交单色填充，返回0已交给加速器，非0需要软件完成 */
+int akiegui_gpu_fill(
+    void *base, uint32_t stride, uint8_t format,
+    int32_t x, int32_t y, int32_t w, int32_t h,
+    uint32_t color, uint8_t opa
+);
+
+/* 提交像素块搬运（mode 为 AKIEGUI_BLIT_xxx），返回0已交给加速器，非0需要软件完成 */
+int akiegui_gpu_blit(
+    void *base, uint32_t stride, uint8_t format,
+    int32_t x, int32_t y, int32_t w, int32_t h,
+    const void *src, uint32_t src_stride, uint8_t src_format,
+    uint8_t mode, uint8_t opa
+);
+
+/* ============= 软件参考实现 ============= */
+extern const AkieGUI_GPU_Ops_T AkieGUI_GPU_SoftOps;
+
+/* 执行队列里最多 max_jobs 个操作（0=全部），返回执行的个数 */
+uint32_t akiegui_gpu_soft_process(uint32_t max_jobs);
+
+#endif
@@ -0,0 +1,54 @@
+/* ============= akiegui_gradient.h ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 渐变填充部分
+ *
+ * 直接按行生成渐变，不需要预先烘焙成图片：
+ *   - 线性：16.16定点逐像素累加颜色，不做逐像素乘法
+ *   - 径向：增量开方求距离，查256级颜色表
+ *   - RGB565 下可选 4x4 有序抖动，消除色带
+ *
+ * 颜色参数为 RGB888（0xRRGGBB，alpha 忽略），整体透明度跟随 akiegui_set_opa
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#ifndef __AKIEGUI_GRADIENT_H__
+#define __AKIEGUI_GRADIENT_H__
+
+#include "akiegui_core.h"
+#include "akiegui_color.h"
+#include <stdint.h>
+
+/* RGB565 下是否做 4x4 有序抖动（24/32位色无效）*/
+#ifndef AkieGUI_GRAD_DITHER
+#define AkieGUI_GRAD_DITHER     1
+#endif
+
+/* ============= 线性渐变方向 ============= */
+#define AKIEGUI_GRAD_HOR        0     /* 从左 c0 到右 c1 */
+#define AKIEGUI_GRAD_VER        1     /* 从上 c0 到下 c1 */
+
+/* 线性渐变填充矩形，两端像素分别正好是 c0、c1 */
+void akiegui_fill_linear_gradient(
+    void *fb,
+    int16_t x, int16_t y,
+    uint16_t w, uint16_t h,
+    uint32_t c0, uint32_t c1,
+    uint8_t dir
+);
+
+/* 径向渐变填充矩形：圆心 (cx, cy) 处为 c0，距离 r 及以外为 c1 */
+void akiegui_fill_radial_gradient(
+    void *fb,
+    int16_t x, int16_t y,
+    uint16_t w, uint16_t h,
+    int16_t cx, int16_t cy,
+    uint16_t r,
+    uint32_t c0, uint32_t c1
+);
+
+#endif
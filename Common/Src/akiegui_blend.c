@@ -0,0 +1,141 @@
+/* ============= akiegui_blend.c ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 颜色混合部分
+ *
+ * 批量混合内核：
+ *   - 单色固定透明度：前景乘积只算一次，RGB565 每个32位字混合两个像素
+ *   - 逐像素 alpha 的 ARGB8888 源
+ *   - 预乘 ARGB8888 源
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#include "akiegui_blend.h"
+#include "akiegui_draw.h"
+
+#if defined(__GNUC__)
+typedef uint32_t akiegui_blend_u32_t __attribute__((__may_alias__));
+#else
+typedef uint32_t akiegui_blend_u32_t;
+#endif
+
+/**
+  * @brief	单色、固定透明度混合一段连续像素
+  *	@param	dst: 起始像素地址
+  *	@param	count: 像素个数
+  *	@param	color: 前景颜色
+  *	@param	opa: 透明度 0~255
+*/
+void akiegui_blend_span(void *dst, uint32_t count, akiegui_color_t color, uint8_t opa) {
+    if (!dst || count == 0 || opa == AKIEGUI_OPA_TRANSP) return;
+    if (opa == AKIEGUI_OPA_COVER) {
+        akiegui_fill_span(dst, count, color);
+        return;
+    }
+
+#if AkieGUI_LCD_BPP == 16
+    uint16_t *d = (uint16_t*)dst;
+    uint32_t a = ((uint32_t)opa + 4) >> 3;
+    uint32_t ia = 32 - a;
+    uint32_t fg2 = color | ((uint32_t)color << 16);
+    /* 前景部分对整段都一样，预先乘好 */
+    uint32_t f1a = (fg2 & 0x07E0F81Fu) * a;
+    uint32_t f2a = ((fg2 >> 5) & 0x07C0F83Fu) * a;
+
+    /* 头部：对齐到4字节 */
+    if ((uintptr_t)d & 2) {
+        *d = akiegui_blend_rgb565(*d, color, opa);
+        d++;
+        count--;
+    }
+
+    /* 中间：每个32位字两个像素 */
+    akiegui_blend_u32_t *d32 = (akiegui_blend_u32_t*)d;
+    for (; count >= 2; count -= 2, d32++) {
+        uint32_t bg2 = *d32;
+        uint32_t r1 = ((f1a + (bg2 & 0x07E0F81Fu) * ia) >> 5) & 0x07E0F81Fu;
+        uint32_t r2 = ((f2a + ((bg2 >> 5) & 0x07C0F83Fu) * ia) >> 5) & 0x07C0F83Fu;
+        *d32 = r1 | (r2 << 5);
+    }
+
+    /* 尾部 */
+    if (count) {
+        d = (uint16_t*)d32;
+        *d = akiegui_blend_rgb565(*d, color, opa);
+    }
+#else
+    uint32_t *d = (uint32_t*)dst;
+    uint32_t a = (uint32_t)opa + (opa >> 7);
+    uint32_t ia = 256 - a;
+    uint32_t frb = (color & 0x00FF00FFu) * a;
+    uint32_t fg  = (color & 0x0000FF00u) * a;
+    for (; count; count--, d++) {
+        uint32_t bg = *d;
+        uint32_t rb = ((frb + (bg & 0x00FF00FFu) * ia) >> 8) & 0x00FF00FFu;
+        uint32_t g  = ((fg  + (bg & 0x0000FF00u) * ia) >> 8) & 0x0000FF00u;
+        *d = (bg & 0xFF000000u) | rb | g;
+    }
+#endif
+}
+
+/**
+  * @brief	ARGB8888 源像素混合到一段连续像素
+  *	@param	dst: 起始像素地址
+  *	@param	src: ARGB8888 源像素
+  *	@param	count: 像素个数
+  *	@param	opa: 整体透明度 0~255
+*/
+void akiegui_blend_span_argb(void *dst, const uint32_t *src, uint32_t count, uint8_t opa) {
+    if (!dst || !src || opa == AKIEGUI_OPA_TRANSP) return;
+
+#if AkieGUI_LCD_BPP == 16
+    uint16_t *d = (uint16_t*)dst;
+#else
+    uint32_t *d = (uint32_t*)dst;
+#endif
+    for (; count; count--, d++, src++) {
+        uint32_t argb = *src;
+        uint32_t a = argb >> 24;
+        /* 全透明、全不透明的像素不做乘法 */
+        if (a == 0) continue;
+        if (a == 0xFF && opa == AKIEGUI_OPA_COVER) {
+            *d = akiegui_argb888_to_native(argb);
+            continue;
+        }
+        *d = akiegui_blend_argb(*d, argb, opa);
+    }
+}
+
+/**
+  * @brief	预乘 ARGB8888 源像素混合到一段连续像素
+  *	@param	dst: 起始像素地址
+  *	@param	src: 预乘 ARGB8888 源像素
+  *	@param	count: 像素个数
+*/
+void akiegui_blend_span_premul(void *dst, const uint32_t *src, uint32_t count) {
+    if (!dst || !src) return;
+
+#if AkieGUI_LCD_BPP == 16
+    uint16_t *d = (uint16_t*)dst;
+    for (; count; count--, d++, src++) {
+        uint32_t p = *src;
+        uint32_t a = p >> 24;
+        if (a == 0) continue;
+        /* 截断转换保持“向下取整”，与背景项相加不会溢出 */
+        uint16_t fg = (uint16_t)(((p >> 8) & 0xF800) | ((p >> 5) & 0x07E0) | ((p >> 3) & 0x001F));
+        *d = (a == 0xFF) ? fg : akiegui_blend_rgb565_premul(*d, fg, (uint8_t)a);
+    }
+#else
+    uint32_t *d = (uint32_t*)dst;
+    for (; count; count--, d++, src++) {
+        uint32_t p = *src;
+        uint32_t a = p >> 24;
+        if (a == 0) continue;
+        *d = (a == 0xFF) ? (p | 0xFF000000u) : akiegui_blend_argb8888_premul(*d, p);
+    }
+#endif
+}
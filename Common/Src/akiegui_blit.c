@@ -0,0 +1,662 @@
+/* ============= akiegui_blit.c ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 像素块搬运部分
+ *
+ * 按行处理：
+ *   - 同格式：memcpy（两边都紧密排列时整块一次复制）
+ *   - 不同格式：转换矩阵里有专用内核就直接转换，没有的经 ARGB8888 中转
+ *   - 关键色：按非关键色的连续段转换复制
+ *   - 混合：源先转成 ARGB8888（每次 BLIT_CHUNK 个像素），再混合到目标
+ *
+ * 注意：RGB565、ARGB8888 缓冲区需按像素大小对齐
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#include "akiegui_blit.h"
+#include "akiegui_blend.h"
+#include "akiegui_draw.h"
+#include "akiegui_gpu.h"
+#include "akiegui_dlist.h"
+#include <string.h>
+
+#if AKIEGUI_ENABLE_SIMD && (defined(__SSE2__) || defined(_M_X64))
+#include <emmintrin.h>
+#define AKIEGUI_BLIT_SSE2 1
+#elif AKIEGUI_ENABLE_SIMD && defined(__ARM_NEON) && \
+      !(defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#include <arm_neon.h>
+#define AKIEGUI_BLIT_NEON 1
+#endif
+
+/* 中转缓冲区的像素个数（在栈上，每个像素4字节）*/
+#define BLIT_CHUNK  64
+
+typedef void (*row_conv_t)(void *dst, const void *src, uint32_t n);
+
+/* ============= 单像素打包 ============= */
+static inline uint16_t pack_rgb565(uint32_t argb) {
+    return (uint16_t)(((argb >> 8) & 0xF800) | ((argb >> 5) & 0x07E0) | ((argb >> 3) & 0x001F));
+}
+
+static inline uint32_t unpack_rgb565(uint32_t c) {
+    uint32_t r = (c >> 11) & 0x1F;
+    uint32_t g = (c >> 5) & 0x3F;
+    uint32_t b = c & 0x1F;
+    return 0xFF000000u | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+}
+
+/* ============= 转换内核 ============= */
+
+/**
+  * @brief	ARGB8888 → RGB565（SSE2/NEON 每次8/16个像素）
+*/
+static void conv_argb8888_rgb565(void *dst, const void *src, uint32_t n) {
+    uint16_t *d = (uint16_t*)dst;
+    const uint32_t *s = (const uint32_t*)src;
+#if defined(AKIEGUI_BLIT_SSE2)
+    const __m128i mr = _mm_set1_epi32(0xF800);
+    const __m128i mg = _mm_set1_epi32(0x07E0);
+    const __m128i mb = _mm_set1_epi32(0x001F);
+    const __m128i bias32 = _mm_set1_epi32(0x8000);
+    const __m128i bias16 = _mm_set1_epi16((short)0x8000);
+    for (; n >= 8; n -= 8, s += 8, d += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i*)s);
+        __m128i b = _mm_loadu_si128((const __m128i*)(s + 4));
+        a = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(a, 8), mr),
+                                      _mm_and_si128(_mm_srli_epi32(a, 5), mg)),
+                         _mm_and_si128(_mm_srli_epi32(a, 3), mb));
+        b = _mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(b, 8), mr),
+                                      _mm_and_si128(_mm_srli_epi32(b, 5), mg)),
+                         _mm_and_si128(_mm_srli_epi32(b, 3), mb));
+        /* packs 是有符号饱和，先减 0x8000 再加回来 */
+        __m128i p = _mm_packs_epi32(_mm_sub_epi32(a, bias32), _mm_sub_epi32(b, bias32));
+        _mm_storeu_si128((__m128i*)d, _mm_xor_si128(p, bias16));
+    }
+#elif defined(AKIEGUI_BLIT_NEON)
+    for (; n >= 16; n -= 16, s += 16, d += 16) {
+        uint8x16x4_t px = vld4q_u8((const uint8_t*)s);     /* B,G,R,A */
+        uint16x8_t lo = vshll_n_u8(vget_low_u8(px.val[2]), 8);
+        uint16x8_t hi = vshll_n_u8(vget_high_u8(px.val[2]), 8);
+        lo = vsriq_n_u16(lo, vshll_n_u8(vget_low_u8(px.val[1]), 8), 5);
+        hi = vsriq_n_u16(hi, vshll_n_u8(vget_high_u8(px.val[1]), 8), 5);
+        lo = vsriq_n_u16(lo, vshll_n_u8(vget_low_u8(px.val[0]), 8), 11);
+        hi = vsriq_n_u16(hi, vshll_n_u8(vget_high_u8(px.val[0]), 8), 11);
+        vst1q_u16(d, lo);
+        vst1q_u16(d + 8, hi);
+    }
+#endif
+    for (; n; n--) *d++ = pack_rgb565(*s++);
+}
+
+/**
+  * @brief	A,R,G,B 字节 → RGB565（SSE2/NEON 每次8/16个像素）
+*/
+static void conv_argb8888be_rgb565(void *dst, const void *src, uint32_t n) {
+    uint16_t *d = (uint16_t*)dst;
+    const uint8_t *s = (const uint8_t*)src;
+#if defined(AKIEGUI_BLIT_SSE2)
+    /* 小端读入后每个32位为 B<<24 | G<<16 | R<<8 | A */
+    const __m128i mr = _mm_set1_epi32(0xF800);
+    const __m128i mg = _mm_set1_epi32(0x07E0);
+    const __m128i bias32 = _mm_set1_epi32(0x8000);
+    const __m128i bias16 = _mm_set1_epi16((short)0x8000);
+    for (; n >= 8; n -= 8, s += 32, d += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i*)s);
+        __m128i b = _mm_loadu_si128((const __m128i*)(s + 16));
+        a = _mm_or_si128(_mm_or_si128(_mm_and_si128(a, mr),
+                                      _mm_and_si128(_mm_srli_epi32(a, 13), mg)),
+                         _mm_srli_epi32(a, 27));
+        b = _mm_or_si128(_mm_or_si128(_mm_and_si128(b, mr),
+                                      _mm_and_si128(_mm_srli_epi32(b, 13), mg)),
+                         _mm_srli_epi32(b, 27));
+        __m128i p = _mm_packs_epi32(_mm_sub_epi32(a, bias32), _mm_sub_epi32(b, bias32));
+        _mm_storeu_si128((__m128i*)d, _mm_xor_si128(p, bias16));
+    }
+#elif defined(AKIEGUI_BLIT_NEON)
+    for (; n >= 16; n -= 16, s += 64, d += 16) {
+        uint8x16x4_t px = vld4q_u8(s);                      /* A,R,G,B */
+        uint16x8_t lo = vshll_n_u8(vget_low_u8(px.val[1]), 8);
+        uint16x8_t hi = vshll_n_u8(vget_high_u8(px.val[1]), 8);
+        lo = vsriq_n_u16(lo, vshll_n_u8(vget_low_u8(px.val[2]), 8), 5);
+        hi = vsriq_n_u16(hi, vshll_n_u8(vget_high_u8(px.val[2]), 8), 5);
+        lo = vsriq_n_u16(lo, vshll_n_u8(vget_low_u8(px.val[3]), 8), 11);
+        hi = vsriq_n_u16(hi, vshll_n_u8(vget_high_u8(px.val[3]), 8), 11);
+        vst1q_u16(d, lo);
+        vst1q_u16(d + 8, hi);
+    }
+#endif
+    for (; n; n--, s += 4) {
+        *d++ = (uint16_t)(((s[1] & 0xF8) << 8) | ((s[2] & 0xFC) << 3) | (s[3] >> 3));
+    }
+}
+
+static void conv_rgb888_rgb565(void *dst, const void *src, uint32_t n) {
+    uint16_t *d = (uint16_t*)dst;
+    const uint8_t *s = (const uint8_t*)src;
+    for (; n; n--, s += 3) {
+        *d++ = (uint16_t)(((s[0] & 0xF8) << 8) | ((s[1] & 0xFC) << 3) | (s[2] >> 3));
+    }
+}
+
+static void conv_l8_rgb565(void *dst, const void *src, uint32_t n) {
+    uint16_t *d = (uint16_t*)dst;
+    const uint8_t *s = (const uint8_t*)src;
+    for (; n; n--, s++) {
+        *d++ = (uint16_t)(((*s & 0xF8) << 8) | ((*s & 0xFC) << 3) | (*s >> 3));
+    }
+}
+
+static void conv_rgb565_argb8888(void *dst, const void *src, uint32_t n) {
+    uint32_t *d = (uint32_t*)dst;
+    const uint16_t *s = (const uint16_t*)src;
+    for (; n; n--) *d++ = unpack_rgb565(*s++);
+}
+
+static void conv_rgb888_argb8888(void *dst, const void *src, uint32_t n) {
+    uint32_t *d = (uint32_t*)dst;
+    const uint8_t *s = (const uint8_t*)src;
+    for (; n; n--, s += 3) {
+        *d++ = 0xFF000000u | ((uint32_t)s[0] << 16) | ((uint32_t)s[1] << 8) | s[2];
+    }
+}
+
+static void conv_argb8888be_argb8888(void *dst, const void *src, uint32_t n) {
+    uint32_t *d = (uint32_t*)dst;
+    const uint8_t *s = (const uint8_t*)src;
+    for (; n; n--, s += 4) {
+        *d++ = ((uint32_t)s[0] << 24) | ((uint32_t)s[1] << 16) | ((uint32_t)s[2] << 8) | s[3];
+    }
+}
+
+static void conv_l8_argb8888(void *dst, const void *src, uint32_t n) {
+    uint32_t *d = (uint32_t*)dst;
+    const uint8_t *s = (const uint8_t*)src;
+    for (; n; n--) *d++ = 0xFF000000u | (*s++ * 0x010101u);
+}
+
+static void conv_argb8888_rgb888(void *dst, const void *src, uint32_t n) {
+    uint8_t *d = (uint8_t*)dst;
+    const uint32_t *s = (const uint32_t*)src;
+    for (; n; n--, d += 3) {
+        uint32_t p = *s++;
+        d[0] = (uint8_t)(p >> 16);
+        d[1] = (uint8_t)(p >> 8);
+        d[2] = (uint8_t)p;
+    }
+}
+
+static void conv_argb8888_argb8888be(void *dst, const void *src, uint32_t n) {
+    uint8_t *d = (uint8_t*)dst;
+    const uint32_t *s = (const uint32_t*)src;
+    for (; n; n--, d += 4) {
+        uint32_t p = *s++;
+        d[0] = (uint8_t)(p >> 24);
+        d[1] = (uint8_t)(p >> 16);
+        d[2] = (uint8_t)(p >> 8);
+        d[3] = (uint8_t)p;
+    }
+}
+
+static void conv_argb8888_l8(void *dst, const void *src, uint32_t n) {
+    uint8_t *d = (uint8_t*)dst;
+    const uint32_t *s = (const uint32_t*)src;
+    for (; n; n--) {
+        uint32_t p = *s++;
+        *d++ = (uint8_t)((((p >> 16) & 0xFF) * 77 + ((p >> 8) & 0xFF) * 150 + (p & 0xFF) * 29) >> 8);
+    }
+}
+
+/* 转换矩阵 [源][目标]：ARGB8888 的行和列是完整的，其余缺的组合经 ARGB8888 中转 */
+static const row_conv_t s_conv[AKIEGUI_FMT_COUNT][AKIEGUI_FMT_COUNT] = {
+    [AKIEGUI_FMT_RGB565] = {
+        [AKIEGUI_FMT_ARGB8888]    = conv_rgb565_argb8888,
+    },
+    [AKIEGUI_FMT_RGB888] = {
+        [AKIEGUI_FMT_RGB565]      = conv_rgb888_rgb565,
+        [AKIEGUI_FMT_ARGB8888]    = conv_rgb888_argb8888,
+    },
+    [AKIEGUI_FMT_ARGB8888] = {
+        [AKIEGUI_FMT_RGB565]      = conv_argb8888_rgb565,
+        [AKIEGUI_FMT_RGB888]      = conv_argb8888_rgb888,
+        [AKIEGUI_FMT_ARGB8888_BE] = conv_argb8888_argb8888be,
+        [AKIEGUI_FMT_L8]          = conv_argb8888_l8,
+    },
+    [AKIEGUI_FMT_ARGB8888_BE] = {
+        [AKIEGUI_FMT_RGB565]      = conv_argb8888be_rgb565,
+        [AKIEGUI_FMT_ARGB8888]    = conv_argb8888be_argb8888,
+    },
+    [AKIEGUI_FMT_L8] = {
+        [AKIEGUI_FMT_RGB565]      = conv_l8_rgb565,
+        [AKIEGUI_FMT_ARGB8888]    = conv_l8_argb8888,
+    },
+};
+
+/**
+  * @brief	源像素转成 ARGB8888，源本身就是 ARGB8888 时直接返回源指针
+*/
+static inline const uint32_t* to_argb(uint32_t *buf, const uint8_t *src, uint8_t fmt, uint32_t n) {
+    if (fmt == AKIEGUI_FMT_ARGB8888) return (const uint32_t*)src;
+    s_conv[fmt][AKIEGUI_FMT_ARGB8888](buf, src, n);
+    return buf;
+}
+
+/* ============= 混合 ============= */
+
+/**
+  * @brief	预乘像素再乘整体透明度
+*/
+static inline uint32_t premul_scale(uint32_t p, uint8_t opa) {
+    uint32_t a = AKIEGUI_DIV255((p >> 24) * opa);
+    uint32_t r = AKIEGUI_DIV255(((p >> 16) & 0xFF) * opa);
+    uint32_t g = AKIEGUI_DIV255(((p >> 8) & 0xFF) * opa);
+    uint32_t b = AKIEGUI_DIV255((p & 0xFF) * opa);
+    return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+/**
+  * @brief	ARGB8888 像素混合到目标行（n 不超过 BLIT_CHUNK）
+  * @param  premul: 源是否为预乘 alpha
+*/
+static void blend_row(uint8_t *d, uint8_t dfmt, const uint32_t *s, uint32_t n,
+                      uint8_t premul, uint8_t opa) {
+    if (dfmt == AKIEGUI_FMT_RGB565) {
+        uint16_t *dp = (uint16_t*)d;
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t p = s[i];
+            uint32_t a;
+            if (premul) {
+                if (opa != AKIEGUI_OPA_COVER) p = premul_scale(p, opa);
+                a = p >> 24;
+                if (a == 0) continue;
+                dp[i] = (a == 0xFF) ? pack_rgb565(p)
+                                    : akiegui_blend_rgb565_premul(dp[i], pack_rgb565(p), (uint8_t)a);
+            } else {
+                a = p >> 24;
+                if (opa != AKIEGUI_OPA_COVER) a = AKIEGUI_DIV255(a * opa);
+                if (a == 0) continue;
+                dp[i] = (a == 0xFF) ? pack_rgb565(p)
+                                    : akiegui_blend_rgb565(dp[i], pack_rgb565(p), (uint8_t)a);
+            }
+        }
+        return;
+    }
+
+    if (dfmt == AKIEGUI_FMT_ARGB8888) {
+        uint32_t *dp = (uint32_t*)d;
+        for (uint32_t i = 0; i < n; i++) {
+            uint32_t p = s[i];
+            uint32_t a;
+            if (premul) {
+                if (opa != AKIEGUI_OPA_COVER) p = premul_scale(p, opa);
+                a = p >> 24;
+                if (a == 0) continue;
+                dp[i] = (a == 0xFF) ? p : akiegui_blend_argb8888_premul(dp[i], p);
+            } else {
+                a = p >> 24;
+                if (opa != AKIEGUI_OPA_COVER) a = AKIEGUI_DIV255(a * opa);
+                if (a == 0) continue;
+                dp[i] = (a == 0xFF) ? (p | 0xFF000000u) : akiegui_blend_argb8888(dp[i], p, (uint8_t)a);
+            }
+        }
+        return;
+    }
+
+    /* 其他目标格式：读出来转成 ARGB8888 混合后再写回 */
+    uint32_t tmp[BLIT_CHUNK];
+    s_conv[dfmt][AKIEGUI_FMT_ARGB8888](tmp, d, n);
+    blend_row((uint8_t*)tmp, AKIEGUI_FMT_ARGB8888, s, n, premul, opa);
+    s_conv[AKIEGUI_FMT_ARGB8888][dfmt](d, tmp, n);
+}
+
+/* ============= 行处理 ============= */
+
+/**
+  * @brief	复制一段像素（必要时转换格式），透明度不为255时按透明度混合
+*/
+static void copy_run(uint8_t *d, uint8_t dfmt, const uint8_t *s, uint8_t sfmt, uint32_t n, uint8_t opa) {
+    uint8_t sb = akiegui_fmt_bytes(sfmt);
+    uint8_t db = akiegui_fmt_bytes(dfmt);
+    uint32_t buf[BLIT_CHUNK];
+
+    if (opa != AKIEGUI_OPA_COVER) {
+        /* 复制模式不看源 alpha，整体按透明度混合 */
+        while (n) {
+            uint32_t c = (n < BLIT_CHUNK) ? n : BLIT_CHUNK;
+            const uint32_t *argb = to_argb(buf, s, sfmt, c);
+            if (argb != buf) memcpy(buf, argb, c * 4);
+            for (uint32_t i = 0; i < c; i++) buf[i] |= 0xFF000000u;
+            blend_row(d, dfmt, buf, c, 0, opa);
+            s += c * sb;
+            d += c * db;
+            n -= c;
+        }
+        return;
+    }
+
+    if (sfmt == dfmt) {
+        memcpy(d, s, n * sb);
+        return;
+    }
+
+    row_conv_t conv = s_conv[sfmt][dfmt];
+    if (conv) {
+        conv(d, s, n);
+        return;
+    }
+
+    /* 没有专用内核：经 ARGB8888 中转 */
+    while (n) {
+        uint32_t c = (n < BLIT_CHUNK) ? n : BLIT_CHUNK;
+        s_conv[AKIEGUI_FMT_ARGB8888][dfmt](d, to_argb(buf, s, sfmt, c), c);
+        s += c * sb;
+        d += c * db;
+        n -= c;
+    }
+}
+
+/**
+  * @brief	读取源格式的原始像素值（ARGB 格式不含 alpha），用于关键色比较
+*/
+static inline uint32_t raw_pixel(const uint8_t *p, uint8_t fmt) {
+    switch (fmt) {
+    case AKIEGUI_FMT_RGB565:      return *(const uint16_t*)p;
+    case AKIEGUI_FMT_RGB888:      return ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+    case AKIEGUI_FMT_ARGB8888:    return *(const uint32_t*)p & 0x00FFFFFFu;
+    case AKIEGUI_FMT_ARGB8888_BE: return ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+    default:                      return p[0];
+    }
+}
+
+/**
+  * @brief	处理一行
+*/
+static void blit_row(uint8_t *d, uint8_t dfmt, const uint8_t *s, uint8_t sfmt, uint32_t n,
+                     uint8_t mode, uint8_t opa, uint32_t key) {
+    uint8_t sb = akiegui_fmt_bytes(sfmt);
+    uint8_t db = akiegui_fmt_bytes(dfmt);
+
+    if (mode == AKIEGUI_BLIT_COPY) {
+        copy_run(d, dfmt, s, sfmt, n, opa);
+        return;
+    }
+
+    if (mode == AKIEGUI_BLIT_COLORKEY) {
+        /* 跳过关键色，其余按连续段复制 */
+        uint32_t i = 0;
+        while (i < n) {
+            while (i < n && raw_pixel(s + i * sb, sfmt) == key) i++;
+            uint32_t start = i;
+            while (i < n && raw_pixel(s + i * sb, sfmt) != key) i++;
+            if (i > start) copy_run(d + start * db, dfmt, s + start * sb, sfmt, i - start, opa);
+        }
+        return;
+    }
+
+    uint32_t buf[BLIT_CHUNK];
+    while (n) {
+        uint32_t c = (n < BLIT_CHUNK) ? n : BLIT_CHUNK;
+        blend_row(d, dfmt, to_argb(buf, s, sfmt, c), c, mode == AKIEGUI_BLIT_PREMUL, opa);
+        s += c * sb;
+        d += c * db;
+        n -= c;
+    }
+}
+
+/**
+  * @brief	关键色换成比较用的形式（ARGB 格式去掉 alpha）
+*/
+static inline uint32_t normalize_key(uint32_t key, uint8_t fmt) {
+    if (fmt == AKIEGUI_FMT_ARGB8888 || fmt == AKIEGUI_FMT_ARGB8888_BE || fmt == AKIEGUI_FMT_RGB888) {
+        return key & 0x00FFFFFFu;
+    }
+    return key;
+}
+
+static inline uint32_t surface_stride(const AkieGUI_Surface_T *s) {
+    return s->stride ? s->stride : (uint32_t)s->w * akiegui_fmt_bytes(s->format);
+}
+
+/**
+  * @brief	搬运 src 的一块区域到 dst (x, y)，按 [cx0,cx1)×[cy0,cy1) 裁剪
+  * @param  use_gpu: 是否可以交给加速器（加速器的软件实现本身不能再提交）
+*/
+static void blit_clipped(AkieGUI_Surface_T *dst, int32_t x, int32_t y,
+                         const AkieGUI_Surface_T *src, const AkieGUI_Rect_T *src_area,
+                         int32_t cx0, int32_t cy0, int32_t cx1, int32_t cy1,
+                         uint8_t mode, uint8_t opa, uint32_t key, uint8_t use_gpu) {
+    int32_t sx = 0, sy = 0;
+    int32_t w = src->w, h = src->h;
+    if (src_area) {
+        if (src_area->x >= src->w || src_area->y >= src->h) return;
+        sx = src_area->x;
+        sy = src_area->y;
+        w = (sx + src_area->w > src->w) ? src->w - sx : src_area->w;
+        h = (sy + src_area->h > src->h) ? src->h - sy : src_area->h;
+    }
+
+    /* 目标裁剪，源起点跟着移动 */
+    if (x < cx0) { sx += cx0 - x; w -= cx0 - x; x = cx0; }
+    if (y < cy0) { sy += cy0 - y; h -= cy0 - y; y = cy0; }
+    if (x + w > cx1) w = cx1 - x;
+    if (y + h > cy1) h = cy1 - y;
+    if (w <= 0 || h <= 0) return;
+
+    uint8_t sfmt = src->format;
+    uint8_t dfmt = dst->format;
+    uint8_t sb = akiegui_fmt_bytes(sfmt);
+    uint8_t db = akiegui_fmt_bytes(dfmt);
+    uint32_t sstride = surface_stride(src);
+    uint32_t dstride = surface_stride(dst);
+    const uint8_t *s = (const uint8_t*)src->data + (uint32_t)sy * sstride + (uint32_t)sx * sb;
+    uint8_t *d = (uint8_t*)dst->data + (uint32_t)y * dstride + (uint32_t)x * db;
+    key = normalize_key(key, sfmt);
+
+    if (use_gpu) {
+        if (g_akiegui.gpu &&
+            akiegui_gpu_blit(dst->data, dstride, dfmt, x, y, w, h, s, sstride, sfmt, mode, opa) == 0) {
+            return;
+        }
+        akiegui_gpu_wait_rect(dst->data, x, y, w, h);
+    }
+
+    /* 两边都是整行且紧密排列：合并成一行处理 */
+    if ((uint32_t)w * sb == sstride && (uint32_t)w * db == dstride) {
+        w *= h;
+        h = 1;
+    }
+
+    for (int32_t r = 0; r < h; r++) {
+        blit_row(d, dfmt, s, sfmt, (uint32_t)w, mode, opa, key);
+        s += sstride;
+        d += dstride;
+    }
+}
+
+/**
+  * @brief	通用像素块搬运
+  *	@param	dst: 目标缓冲区
+  *	@param	x: 目标坐标 X
+  *	@param	y: 目标坐标 Y
+  *	@param	src: 源缓冲区
+  *	@param	src_area: 源区域，NULL为整个源
+  *	@param	mode: 搬运模式 AKIEGUI_BLIT_xxx
+  *	@param	opa: 整体透明度 0~255
+  *	@param	key: 关键色（源格式的原始像素值）
+  * @retval	0成功 -1参数错误
+*/
+int akiegui_blit(
+    AkieGUI_Surface_T *dst,
+    int16_t x, int16_t y,
+    const AkieGUI_Surface_T *src,
+    const AkieGUI_Rect_T *src_area,
+    uint8_t mode,
+    uint8_t opa,
+    uint32_t key
+) {
+    if (!dst || !src || !dst->data || !src->data) return -1;
+    if (dst->format >= AKIEGUI_FMT_COUNT || src->format >= AKIEGUI_FMT_COUNT) return -1;
+    if (mode > AKIEGUI_BLIT_PREMUL) return -1;
+    if (opa == AKIEGUI_OPA_TRANSP) return 0;
+
+    blit_clipped(dst, x, y, src, src_area, 0, 0, dst->w, dst->h, mode, opa, key, 1);
+    return 0;
+}
+
+/**
+  * @brief	只用CPU的像素块搬运（参数同 akiegui_blit，供加速器的软件实现使用）
+*/
+int akiegui_blit_cpu(
+    AkieGUI_Surface_T *dst,
+    int16_t x, int16_t y,
+    const AkieGUI_Surface_T *src,
+    const AkieGUI_Rect_T *src_area,
+    uint8_t mode,
+    uint8_t opa,
+    uint32_t key
+) {
+    if (!dst || !src || !dst->data || !src->data) return -1;
+    if (dst->format >= AKIEGUI_FMT_COUNT || src->format >= AKIEGUI_FMT_COUNT) return -1;
+    if (mode > AKIEGUI_BLIT_PREMUL) return -1;
+    if (opa == AKIEGUI_OPA_TRANSP) return 0;
+
+    blit_clipped(dst, x, y, src, src_area, 0, 0, dst->w, dst->h, mode, opa, key, 0);
+    return 0;
+}
+
+/**
+  * @brief	帧缓冲的缓冲区描述，以及当前裁剪区
+*/
+static void fb_surface(void *fb, AkieGUI_Surface_T *s, int32_t *cx0, int32_t *cy0, int32_t *cx1, int32_t *cy1) {
+    akiegui_surface_init(s, fb, (uint16_t)g_akiegui.fb_width, (uint16_t)g_akiegui.fb_height, AKIEGUI_FMT_NATIVE);
+
+    AkieGUI_Rect_T clip;
+    akiegui_clip_get(&clip);
+    *cx0 = clip.x;
+    *cy0 = clip.y;
+    *cx1 = clip.x + clip.w;
+    *cy1 = clip.y + clip.h;
+}
+
+/**
+  * @brief	像素块搬运到帧缓冲（按当前裁剪区裁剪，乘以绘制透明度）
+  *	@param	fb: 绘制缓冲区
+  *	@param	x: 目标坐标 X
+  *	@param	y: 目标坐标 Y
+  *	@param	src: 源缓冲区
+  *	@param	src_area: 源区域，NULL为整个源
+  *	@param	mode: 搬运模式 AKIEGUI_BLIT_xxx
+  *	@param	key: 关键色（源格式的原始像素值）
+*/
+void akiegui_draw_blit(
+    void *fb,
+    int16_t x, int16_t y,
+    const AkieGUI_Surface_T *src,
+    const AkieGUI_Rect_T *src_area,
+    uint8_t mode,
+    uint32_t key
+) {
+    if (!fb || !src || !src->data || src->format >= AKIEGUI_FMT_COUNT) return;
+    if (mode > AKIEGUI_BLIT_PREMUL || g_akiegui.draw_opa == AKIEGUI_OPA_TRANSP) return;
+    if (g_akiegui.dl) {
+        akiegui_dl_blit(x, y, 0, 0, src, src_area, mode, key);
+        return;
+    }
+
+    AkieGUI_Surface_T dst;
+    int32_t cx0, cy0, cx1, cy1;
+    fb_surface(fb, &dst, &cx0, &cy0, &cx1, &cy1);
+    blit_clipped(&dst, x, y, src, src_area, cx0, cy0, cx1, cy1, mode, g_akiegui.draw_opa, key, 1);
+}
+
+/**
+  * @brief	缩放搬运到帧缓冲（最近邻）
+  * @note   源坐标用16.16定点数逐像素累加，不做除法；每次取 BLIT_CHUNK 个采样点
+  *         拼成一段源格式像素，再走与不缩放时相同的行处理
+  *	@param	fb: 绘制缓冲区
+  *	@param	x: 目标坐标 X
+  *	@param	y: 目标坐标 Y
+  *	@param	w: 目标宽度
+  *	@param	h: 目标高度
+  *	@param	src: 源缓冲区
+  *	@param	mode: 搬运模式 AKIEGUI_BLIT_xxx
+  *	@param	key: 关键色（源格式的原始像素值）
+*/
+void akiegui_draw_blit_scaled(
+    void *fb,
+    int16_t x, int16_t y,
+    uint16_t w, uint16_t h,
+    const AkieGUI_Surface_T *src,
+    uint8_t mode,
+    uint32_t key
+) {
+    if (!fb || !src || !src->data || src->format >= AKIEGUI_FMT_COUNT) return;
+    if (w == 0 || h == 0 || src->w == 0 || src->h == 0) return;
+    if (mode > AKIEGUI_BLIT_PREMUL || g_akiegui.draw_opa == AKIEGUI_OPA_TRANSP) return;
+
+    if (w == src->w && h == src->h) {
+        akiegui_draw_blit(fb, x, y, src, NULL, mode, key);
+        return;
+    }
+    if (g_akiegui.dl) {
+        akiegui_dl_blit(x, y, w, h, src, NULL, mode, key);
+        return;
+    }
+
+    AkieGUI_Surface_T dst;
+    int32_t cx0, cy0, cx1, cy1;
+    fb_surface(fb, &dst, &cx0, &cy0, &cx1, &cy1);
+
+    int32_t x0 = (x > cx0) ? x : cx0;
+    int32_t y0 = (y > cy0) ? y : cy0;
+    int32_t x1 = (x + w < cx1) ? x + w : cx1;
+    int32_t y1 = (y + h < cy1) ? y + h : cy1;
+    if (x1 <= x0 || y1 <= y0) return;
+
+    uint8_t sfmt = src->format;
+    uint8_t sb = akiegui_fmt_bytes(sfmt);
+    uint8_t db = akiegui_fmt_bytes(dst.format);
+    uint32_t sstride = surface_stride(src);
+    uint32_t step_x = ((uint32_t)src->w << 16) / w;
+    uint32_t step_y = ((uint32_t)src->h << 16) / h;
+    uint32_t fx0 = (uint32_t)(x0 - x) * step_x;
+    uint32_t fy = (uint32_t)(y0 - y) * step_y;
+    uint8_t opa = g_akiegui.draw_opa;
+    key = normalize_key(key, sfmt);
+
+    akiegui_gpu_wait_rect(dst.data, x0, y0, x1 - x0, y1 - y0);
+
+    uint32_t samples[BLIT_CHUNK];           /* 按源格式拼接的采样点（4字节对齐）*/
+    uint8_t *tmp = (uint8_t*)samples;
+
+    for (int32_t yy = y0; yy < y1; yy++, fy += step_y) {
+        uint32_t sy = fy >> 16;
+        if (sy >= src->h) sy = src->h - 1;
+        const uint8_t *srow = (const uint8_t*)src->data + sy * sstride;
+        uint8_t *d = (uint8_t*)dst.data + (uint32_t)yy * surface_stride(&dst) + (uint32_t)x0 * db;
+        uint32_t fx = fx0;
+
+        for (int32_t xx = x0; xx < x1; ) {
+            uint32_t c = (uint32_t)(x1 - xx);
+            if (c > BLIT_CHUNK) c = BLIT_CHUNK;
+
+            for (uint32_t i = 0; i < c; i++, fx += step_x) {
+                uint32_t sx = fx >> 16;
+                if (sx >= src->w) sx = src->w - 1;
+                const uint8_t *p = srow + sx * sb;
+                switch (sb) {
+                case 1:  tmp[i] = *p; break;
+                case 2:  ((uint16_t*)tmp)[i] = *(const uint16_t*)p; break;
+                default: memcpy(tmp + i * sb, p, sb); break;
+                }
+            }
+            blit_row(d, dst.format, tmp, sfmt, c, mode, opa, key);
+            d += c * db;
+            xx += c;
+        }
+    }
+}
@@ -0,0 +1,370 @@
+/* ============= akiegui_dlist.c ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 显示列表部分
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#include "akiegui_dlist.h"
+#include "akiegui_draw.h"
+#include "akiegui_blend.h"
+#include "akiegui_gradient.h"
+#include <stddef.h>
+
+#define DL_RECT       0
+#define DL_GLYPH      1
+#define DL_BLIT       2
+#define DL_GRAD       3
+
+#define DL_NO_RUN     0xFFFFFFFFu
+#define DL_ALIGN      sizeof(void*)     /* 命令按指针对齐 */
+
+/* 所有命令的公共头 */
+typedef struct {
+    uint8_t type;           /* DL_xxx */
+    uint8_t opa;            /* 录制时的透明度 */
+    uint16_t size;          /* 整条命令的字节数 */
+    AkieGUI_Rect_T box;     /* 已裁剪的包围盒，回放时按它剔除 */
+} dl_head_t;
+
+typedef struct {
+    dl_head_t hd;
+    akiegui_color_t color;
+} dl_rect_t;
+
+/* 字形串：同一行、等宽、紧挨着的字模，第 i 个在 x + i * width */
+typedef struct {
+    dl_head_t hd;
+    AkieGUI_Rect_T clip;    /* 录制时的裁剪区 */
+    int16_t x, y;
+    uint16_t width, height;
+    akiegui_color_t color;
+    akiegui_color_t bg_color;
+    uint8_t bpp;
+    uint8_t transparent;
+    uint16_t count;
+    const uint8_t *data[];  /* 每个字模的数据 */
+} dl_glyph_t;
+
+typedef struct {
+    dl_head_t hd;
+    AkieGUI_Surface_T src;
+    AkieGUI_Rect_T src_area;
+    int16_t x, y;
+    uint16_t w, h;          /* 缩放后的大小，0=不缩放 */
+    uint32_t key;
+    uint8_t mode;
+    uint8_t has_area;       /* 0=整个源 */
+} dl_blit_t;
+
+typedef struct {
+    dl_head_t hd;
+    int16_t x, y;
+    uint16_t w, h;
+    int16_t cx, cy;
+    uint16_t r;
+    uint8_t radial;
+    uint8_t dir;
+    uint32_t c0, c1;
+} dl_grad_t;
+
+static inline uint32_t dl_round(uint32_t bytes) {
+    return (bytes + DL_ALIGN - 1) & ~(uint32_t)(DL_ALIGN - 1);
+}
+
+/**
+  * @brief	用一块内存初始化显示列表
+  *	@param	dl: 显示列表
+  *	@param	buf: 命令缓冲区（起始地址不对齐时自动跳过开头几个字节）
+  *	@param	size: 缓冲区字节数
+*/
+void akiegui_dl_init(AkieGUI_DList_T *dl, void *buf, uint32_t size) {
+    if (!dl) return;
+    uintptr_t p = (uintptr_t)buf;
+    uintptr_t a = (p + DL_ALIGN - 1) & ~(uintptr_t)(DL_ALIGN - 1);
+    dl->buf = (void*)a;
+    dl->size = (buf && size > a - p) ? size - (uint32_t)(a - p) : 0;
+    dl->used = 0;
+    dl->run = DL_NO_RUN;
+    dl->overflow = 0;
+}
+
+/**
+  * @brief	清空并开始录制
+*/
+void akiegui_dl_begin(AkieGUI_DList_T *dl) {
+    if (!dl) return;
+    dl->used = 0;
+    dl->run = DL_NO_RUN;
+    dl->overflow = 0;
+    g_akiegui.dl = dl;
+}
+
+/**
+  * @brief	结束录制，之后的绘制直接写显存
+*/
+void akiegui_dl_end(void) {
+    g_akiegui.dl = NULL;
+}
+
+/**
+  * @brief	当前录制位置
+  * @note   之后的字模不再并入之前的字形串，保证各段命令互不重叠
+*/
+uint32_t akiegui_dl_mark(AkieGUI_DList_T *dl) {
+    dl->run = DL_NO_RUN;
+    return dl->used;
+}
+
+/**
+  * @brief	分配一条命令
+  * @retval	命令地址，放不下时置 overflow 并返回NULL
+*/
+static void* dl_alloc(AkieGUI_DList_T *dl, uint32_t bytes) {
+    bytes = dl_round(bytes);
+    if (dl->overflow || bytes > 0xFFFF || dl->used + bytes > dl->size) {
+        dl->overflow = 1;
+        return NULL;
+    }
+    void *p = (uint8_t*)dl->buf + dl->used;
+    dl->used += bytes;
+    return p;
+}
+
+/**
+  * @brief	矩形与当前裁剪区求交
+  * @retval	1有可见部分 0完全不可见
+*/
+static uint8_t dl_clip(int32_t x, int32_t y, int32_t w, int32_t h, AkieGUI_Rect_T *box) {
+    AkieGUI_Rect_T c;
+    akiegui_clip_get(&c);
+    int32_t x0 = (x > c.x) ? x : c.x;
+    int32_t y0 = (y > c.y) ? y : c.y;
+    int32_t x1 = (x + w < c.x + c.w) ? x + w : c.x + c.w;
+    int32_t y1 = (y + h < c.y + c.h) ? y + h : c.y + c.h;
+    if (x1 <= x0 || y1 <= y0) return 0;
+    box->x = (uint16_t)x0;
+    box->y = (uint16_t)y0;
+    box->w = (uint16_t)(x1 - x0);
+    box->h = (uint16_t)(y1 - y0);
+    return 1;
+}
+
+/**
+  * @brief	录制已裁剪的单色矩形
+  * @param  opa: 最终透明度（已乘绘制透明度）
+*/
+void akiegui_dl_rect(int32_t x, int32_t y, int32_t w, int32_t h,
+                     akiegui_color_t color, uint8_t opa) {
+    AkieGUI_DList_T *dl = g_akiegui.dl;
+    dl->run = DL_NO_RUN;
+    dl_rect_t *c = (dl_rect_t*)dl_alloc(dl, sizeof(dl_rect_t));
+    if (!c) return;
+
+    c->hd.type = DL_RECT;
+    c->hd.opa = opa;
+    c->hd.size = (uint16_t)dl_round(sizeof(dl_rect_t));
+    c->hd.box.x = (uint16_t)x;
+    c->hd.box.y = (uint16_t)y;
+    c->hd.box.w = (uint16_t)w;
+    c->hd.box.h = (uint16_t)h;
+    c->color = color;
+}
+
+/**
+  * @brief	录制一个字模，能续接时并入上一个字形串
+  *	@param	x/y: 字模左上角
+  * @param  data: 字模数据
+  * @param  width/height: 字模大小
+  * @param  bpp: 每像素位数（1、2、4）
+  *	@param	color: 前景颜色
+  *	@param	bg_color: 背景颜色
+  * @param  transparent: 背景是否透明
+*/
+void akiegui_dl_glyph(int32_t x, int32_t y, const uint8_t *data,
+                      uint16_t width, uint16_t height, uint8_t bpp,
+                      akiegui_color_t color, akiegui_color_t bg_color, uint8_t transparent) {
+    AkieGUI_DList_T *dl = g_akiegui.dl;
+    AkieGUI_Rect_T clip;
+    akiegui_clip_get(&clip);
+
+    if (dl->run != DL_NO_RUN) {
+        dl_glyph_t *g = (dl_glyph_t*)((uint8_t*)dl->buf + dl->run);
+        if (dl->run + g->hd.size == dl->used && g->hd.opa == g_akiegui.draw_opa &&
+            g->y == y && g->x + (int32_t)g->count * width == x &&
+            g->width == width && g->height == height && g->bpp == bpp &&
+            g->color == color && g->bg_color == bg_color && g->transparent == transparent &&
+            g->clip.x == clip.x && g->clip.y == clip.y && g->clip.w == clip.w && g->clip.h == clip.h &&
+            dl_round(g->hd.size + sizeof(const uint8_t*)) <= 0xFFFF &&
+            dl_alloc(dl, dl_round(g->hd.size + sizeof(const uint8_t*)) - g->hd.size)) {
+            g->data[g->count++] = data;
+            g->hd.size = (uint16_t)(dl->used - dl->run);
+            dl_clip(g->x, g->y, (int32_t)g->count * width, height, &g->hd.box);
+            return;
+        }
+    }
+
+    AkieGUI_Rect_T box;
+    if (!dl_clip(x, y, width, height, &box)) return;
+    uint32_t off = dl->used;
+    dl_glyph_t *g = (dl_glyph_t*)dl_alloc(dl, sizeof(dl_glyph_t) + sizeof(const uint8_t*));
+    if (!g) return;
+
+    g->hd.type = DL_GLYPH;
+    g->hd.opa = g_akiegui.draw_opa;
+    g->hd.size = (uint16_t)(dl->used - off);
+    g->hd.box = box;
+    g->clip = clip;
+    g->x = (int16_t)x;
+    g->y = (int16_t)y;
+    g->width = width;
+    g->height = height;
+    g->color = color;
+    g->bg_color = bg_color;
+    g->bpp = bpp;
+    g->transparent = transparent;
+    g->count = 1;
+    g->data[0] = data;
+    dl->run = off;
+}
+
+/**
+  * @brief	录制图片搬运（参数同 akiegui_draw_blit / akiegui_draw_blit_scaled）
+  *	@param	w/h: 缩放后的大小，0为不缩放
+*/
+void akiegui_dl_blit(int16_t x, int16_t y, uint16_t w, uint16_t h,
+                     const AkieGUI_Surface_T *src, const AkieGUI_Rect_T *src_area,
+                     uint8_t mode, uint32_t key) {
+    AkieGUI_DList_T *dl = g_akiegui.dl;
+    dl->run = DL_NO_RUN;
+
+    /* 包围盒按源区域大小估计，多一些不影响结果 */
+    int32_t bw = w ? w : (src_area ? src_area->w : src->w);
+    int32_t bh = h ? h : (src_area ? src_area->h : src->h);
+    AkieGUI_Rect_T box;
+    if (!dl_clip(x, y, bw, bh, &box)) return;
+
+    dl_blit_t *c = (dl_blit_t*)dl_alloc(dl, sizeof(dl_blit_t));
+    if (!c) return;
+
+    c->hd.type = DL_BLIT;
+    c->hd.opa = g_akiegui.draw_opa;
+    c->hd.size = (uint16_t)dl_round(sizeof(dl_blit_t));
+    c->hd.box = box;
+    c->src = *src;
+    if (src_area) c->src_area = *src_area;
+    c->has_area = (src_area != NULL);
+    c->x = x;
+    c->y = y;
+    c->w = w;
+    c->h = h;
+    c->key = key;
+    c->mode = mode;
+}
+
+/**
+  * @brief	录制渐变填充（参数同 akiegui_fill_linear_gradient / akiegui_fill_radial_gradient）
+  *	@param	radial: 0线性 1径向
+*/
+void akiegui_dl_gradient(uint8_t radial, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                         int16_t cx, int16_t cy, uint16_t r,
+                         uint32_t c0, uint32_t c1, uint8_t dir) {
+    AkieGUI_DList_T *dl = g_akiegui.dl;
+    dl->run = DL_NO_RUN;
+
+    AkieGUI_Rect_T box;
+    if (!dl_clip(x, y, w, h, &box)) return;
+
+    dl_grad_t *c = (dl_grad_t*)dl_alloc(dl, sizeof(dl_grad_t));
+    if (!c) return;
+
+    c->hd.type = DL_GRAD;
+    c->hd.opa = g_akiegui.draw_opa;
+    c->hd.size = (uint16_t)dl_round(sizeof(dl_grad_t));
+    c->hd.box = box;
+    c->x = x;
+    c->y = y;
+    c->w = w;
+    c->h = h;
+    c->cx = cx;
+    c->cy = cy;
+    c->r = r;
+    c->radial = radial;
+    c->dir = dir;
+    c->c0 = c0;
+    c->c1 = c1;
+}
+
+/**
+  * @brief	回放一段命令
+  * @note   包围盒与当前裁剪区不相交的命令直接跳过；
+  *         其余命令在包围盒裁剪区内重新执行，结果与录制时直接绘制相同
+  *	@param	dl: 显示列表
+  *	@param	fb: 绘制缓冲区
+  *	@param	from/to: akiegui_dl_mark 返回的起止位置
+*/
+void akiegui_dl_replay(const AkieGUI_DList_T *dl, void *fb, uint32_t from, uint32_t to) {
+    if (!dl || !fb || g_akiegui.dl) return;
+    if (to > dl->used) to = dl->used;
+
+    AkieGUI_Rect_T area;
+    akiegui_clip_get(&area);
+    if (area.w == 0 || area.h == 0) return;
+
+    uint8_t saved_opa = g_akiegui.draw_opa;
+    const uint8_t *p = (const uint8_t*)dl->buf + from;
+    const uint8_t *end = (const uint8_t*)dl->buf + to;
+
+    while (p < end) {
+        const dl_head_t *hd = (const dl_head_t*)p;
+        p += hd->size;
+
+        const AkieGUI_Rect_T *b = &hd->box;
+        if (b->x >= area.x + area.w || area.x >= b->x + b->w ||
+            b->y >= area.y + area.h || area.y >= b->y + b->h) {
+            continue;
+        }
+
+        if (hd->type == DL_RECT) {
+            const dl_rect_t *c = (const dl_rect_t*)hd;
+            g_akiegui.draw_opa = AKIEGUI_OPA_COVER;
+            akiegui_draw_rect_opa(fb, b->x, b->y, b->w, b->h, c->color, hd->opa);
+            continue;
+        }
+
+        if (akiegui_clip_push(b->x, b->y, b->w, b->h) != 0) continue;
+        g_akiegui.draw_opa = hd->opa;
+
+        if (hd->type == DL_GLYPH) {
+            const dl_glyph_t *c = (const dl_glyph_t*)hd;
+            int32_t x = c->x;
+            for (uint16_t i = 0; i < c->count; i++, x += c->width) {
+                akiegui_draw_glyph(fb, (int16_t)x, c->y, c->data[i], c->width, c->height, c->bpp,
+                                   c->color, c->bg_color, c->transparent);
+            }
+        } else if (hd->type == DL_BLIT) {
+            const dl_blit_t *c = (const dl_blit_t*)hd;
+            if (c->w) {
+                akiegui_draw_blit_scaled(fb, c->x, c->y, c->w, c->h, &c->src, c->mode, c->key);
+            } else {
+                akiegui_draw_blit(fb, c->x, c->y, &c->src, c->has_area ? &c->src_area : NULL,
+                                  c->mode, c->key);
+            }
+        } else if (hd->type == DL_GRAD) {
+            const dl_grad_t *c = (const dl_grad_t*)hd;
+            if (c->radial) {
+                akiegui_fill_radial_gradient(fb, c->x, c->y, c->w, c->h, c->cx, c->cy, c->r,
+                                             c->c0, c->c1);
+            } else {
+                akiegui_fill_linear_gradient(fb, c->x, c->y, c->w, c->h, c->c0, c->c1, c->dir);
+            }
+        }
+        akiegui_clip_pop();
+    }
+
+    g_akiegui.draw_opa = saved_opa;
+}
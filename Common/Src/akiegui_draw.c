@@ -11,8 +11,351 @@
  */
 #include "akiegui_draw.h"
 #include "akiegui_color.h"
+#include "akiegui_blend.h"
+#include "akiegui_blit.h"
+#include "akiegui_gpu.h"
+#include "akiegui_dlist.h"
 #include <string.h>
 
+#if AKIEGUI_ENABLE_SIMD && (defined(__SSE2__) || defined(_M_X64))
+#include <emmintrin.h>
+#define AKIEGUI_FILL_SSE2 1
+#elif AKIEGUI_ENABLE_SIMD && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define AKIEGUI_FILL_NEON 1
+#endif
+
+/* 宽字写入用的别名类型，避免与 uint16_t 显存访问产生严格别名问题 */
+#if defined(__GNUC__)
+typedef uint32_t akiegui_u32_alias_t __attribute__((__may_alias__));
+typedef uint64_t akiegui_u64_alias_t __attribute__((__may_alias__));
+#else
+typedef uint32_t akiegui_u32_alias_t;
+typedef uint64_t akiegui_u64_alias_t;
+#endif
+
+#if AkieGUI_LCD_BPP == 16
+typedef uint16_t akiegui_pixel_t;
+#else
+typedef uint32_t akiegui_pixel_t;
+#endif
+
+#if AkieGUI_LCD_BPP == 16
+/**
+  * @brief	16位像素连续填充
+  * @note   先补齐头部到4/8字节对齐，中间每次写2/4个像素（或128位向量），最后处理尾部
+*/
+static void fill_span16(uint16_t *dst, uint32_t n, uint16_t color) {
+    /* 头部：对齐到4字节 */
+    if (((uintptr_t)dst & 2) && n) {
+        *dst++ = color;
+        n--;
+    }
+    uint32_t c32 = ((uint32_t)color << 16) | color;
+
+#if defined(AKIEGUI_FILL_SSE2)
+    /* 对齐到16字节后每次写8个像素 */
+    while (((uintptr_t)dst & 15) && n >= 2) {
+        *(akiegui_u32_alias_t*)dst = c32;
+        dst += 2;
+        n -= 2;
+    }
+    __m128i v = _mm_set1_epi32((int)c32);
+    while (n >= 32) {
+        _mm_store_si128((__m128i*)dst, v);
+        _mm_store_si128((__m128i*)dst + 1, v);
+        _mm_store_si128((__m128i*)dst + 2, v);
+        _mm_store_si128((__m128i*)dst + 3, v);
+        dst += 32;
+        n -= 32;
+    }
+    while (n >= 8) {
+        _mm_store_si128((__m128i*)dst, v);
+        dst += 8;
+        n -= 8;
+    }
+#elif defined(AKIEGUI_FILL_NEON)
+    uint16x8_t v = vdupq_n_u16(color);
+    while (n >= 32) {
+        vst1q_u16(dst, v);
+        vst1q_u16(dst + 8, v);
+        vst1q_u16(dst + 16, v);
+        vst1q_u16(dst + 24, v);
+        dst += 32;
+        n -= 32;
+    }
+    while (n >= 8) {
+        vst1q_u16(dst, v);
+        dst += 8;
+        n -= 8;
+    }
+#endif
+
+    /* 对齐到8字节后每次写4个像素 */
+    if (((uintptr_t)dst & 4) && n >= 2) {
+        *(akiegui_u32_alias_t*)dst = c32;
+        dst += 2;
+        n -= 2;
+    }
+    uint64_t c64 = ((uint64_t)c32 << 32) | c32;
+    akiegui_u64_alias_t *d64 = (akiegui_u64_alias_t*)dst;
+    while (n >= 16) {
+        d64[0] = c64;
+        d64[1] = c64;
+        d64[2] = c64;
+        d64[3] = c64;
+        d64 += 4;
+        n -= 16;
+    }
+    while (n >= 4) {
+        *d64++ = c64;
+        n -= 4;
+    }
+
+    /* 尾部 */
+    dst = (uint16_t*)d64;
+    if (n >= 2) {
+        *(akiegui_u32_alias_t*)dst = c32;
+        dst += 2;
+        n -= 2;
+    }
+    if (n) *dst = color;
+}
+#else
+/**
+  * @brief	32位像素连续填充
+  * @note   先补齐头部到8字节对齐，中间每次写2个像素（或128位向量），最后处理尾部
+*/
+static void fill_span32(uint32_t *dst, uint32_t n, uint32_t color) {
+#if defined(AKIEGUI_FILL_SSE2)
+    while (((uintptr_t)dst & 15) && n) {
+        *dst++ = color;
+        n--;
+    }
+    __m128i v = _mm_set1_epi32((int)color);
+    while (n >= 16) {
+        _mm_store_si128((__m128i*)dst, v);
+        _mm_store_si128((__m128i*)dst + 1, v);
+        _mm_store_si128((__m128i*)dst + 2, v);
+        _mm_store_si128((__m128i*)dst + 3, v);
+        dst += 16;
+        n -= 16;
+    }
+    while (n >= 4) {
+        _mm_store_si128((__m128i*)dst, v);
+        dst += 4;
+        n -= 4;
+    }
+#elif defined(AKIEGUI_FILL_NEON)
+    uint32x4_t v = vdupq_n_u32(color);
+    while (n >= 16) {
+        vst1q_u32(dst, v);
+        vst1q_u32(dst + 4, v);
+        vst1q_u32(dst + 8, v);
+        vst1q_u32(dst + 12, v);
+        dst += 16;
+        n -= 16;
+    }
+    while (n >= 4) {
+        vst1q_u32(dst, v);
+        dst += 4;
+        n -= 4;
+    }
+#endif
+
+    /* 头部：对齐到8字节 */
+    if (((uintptr_t)dst & 4) && n) {
+        *dst++ = color;
+        n--;
+    }
+    uint64_t c64 = ((uint64_t)color << 32) | color;
+    akiegui_u64_alias_t *d64 = (akiegui_u64_alias_t*)dst;
+    while (n >= 8) {
+        d64[0] = c64;
+        d64[1] = c64;
+        d64[2] = c64;
+        d64[3] = c64;
+        d64 += 4;
+        n -= 8;
+    }
+    while (n >= 2) {
+        *d64++ = c64;
+        n -= 2;
+    }
+
+    /* 尾部 */
+    if (n) *(uint32_t*)d64 = color;
+}
+#endif
+
+/**
+  * @brief	连续像素填充
+  *	@param	dst: 起始像素地址
+  *	@param	count: 像素个数
+  *	@param	color: 填充颜色
+*/
+void akiegui_fill_span(void *dst, uint32_t count, akiegui_color_t color) {
+    if (!dst || count == 0) return;
+#if AkieGUI_LCD_BPP == 16
+    fill_span16((uint16_t*)dst, count, color);
+#else
+    fill_span32((uint32_t*)dst, count, color);
+#endif
+}
+
+/**
+  * @brief	取当前裁剪区（半开区间 [x0,x1) x [y0,y1)）
+*/
+static inline void clip_current(int32_t *x0, int32_t *y0, int32_t *x1, int32_t *y1) {
+    if (g_akiegui.clip_depth == 0) {
+        *x0 = 0;
+        *y0 = 0;
+        *x1 = (int32_t)g_akiegui.fb_width;
+        *y1 = (int32_t)g_akiegui.fb_height;
+    } else {
+        const AkieGUI_Rect_T *c = &g_akiegui.clip_stack[g_akiegui.clip_depth - 1];
+        *x0 = c->x;
+        *y0 = c->y;
+        *x1 = (int32_t)c->x + c->w;
+        *y1 = (int32_t)c->y + c->h;
+    }
+#if AkieGUI_BAND_LINES
+    /* 分段渲染：缓冲区里只有当前条带的行（录制显示列表时不写缓冲区，不受条带限制）*/
+    if (g_akiegui.dl) return;
+    int32_t by0 = g_akiegui.band_y;
+    int32_t by1 = by0 + g_akiegui.band_h;
+    if (*y0 < by0) *y0 = by0;
+    if (*y1 > by1) *y1 = by1;
+    if (*y1 < *y0) *y1 = *y0;
+#endif
+}
+
+/**
+  * @brief	压入裁剪区，与当前裁剪区求交
+  *	@param	x: 裁剪区坐标 X
+  *	@param	y: 裁剪区坐标 Y
+  *	@param	w: 裁剪区宽度
+  *	@param	h: 裁剪区高度
+  * @retval	0成功 -1栈满
+*/
+int akiegui_clip_push(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    if (g_akiegui.clip_depth >= AkieGUI_CLIP_STACK_DEPTH) return -1;
+
+    int32_t cx0, cy0, cx1, cy1;
+    clip_current(&cx0, &cy0, &cx1, &cy1);
+
+    int32_t x0 = (x > cx0) ? x : cx0;
+    int32_t y0 = (y > cy0) ? y : cy0;
+    int32_t x1 = ((int32_t)x + w < cx1) ? (int32_t)x + w : cx1;
+    int32_t y1 = ((int32_t)y + h < cy1) ? (int32_t)y + h : cy1;
+
+    AkieGUI_Rect_T *c = &g_akiegui.clip_stack[g_akiegui.clip_depth++];
+    if (x1 <= x0 || y1 <= y0) {
+        /* 空裁剪区：之后的绘制全部丢弃 */
+        c->x = 0; c->y = 0; c->w = 0; c->h = 0;
+    } else {
+        c->x = (uint16_t)x0;
+        c->y = (uint16_t)y0;
+        c->w = (uint16_t)(x1 - x0);
+        c->h = (uint16_t)(y1 - y0);
+    }
+    return 0;
+}
+
+/**
+  * @brief	弹出裁剪区
+*/
+void akiegui_clip_pop(void) {
+    if (g_akiegui.clip_depth > 0) g_akiegui.clip_depth--;
+}
+
+/**
+  * @brief	清空裁剪栈（恢复为整个帧缓冲）
+*/
+void akiegui_clip_reset(void) {
+    g_akiegui.clip_depth = 0;
+}
+
+/**
+  * @brief	获取当前裁剪区
+  *	@param	out: 输出矩形
+*/
+void akiegui_clip_get(AkieGUI_Rect_T *out) {
+    if (!out) return;
+    int32_t x0, y0, x1, y1;
+    clip_current(&x0, &y0, &x1, &y1);
+    out->x = (uint16_t)x0;
+    out->y = (uint16_t)y0;
+    out->w = (uint16_t)(x1 - x0);
+    out->h = (uint16_t)(y1 - y0);
+}
+
+/**
+  * @brief	设置绘制透明度，之后的矩形、文字都按此透明度混合到显存
+  *	@param	opa: 透明度 0~255（255=不透明）
+*/
+void akiegui_set_opa(uint8_t opa) {
+    g_akiegui.draw_opa = opa;
+}
+
+/**
+  * @brief	裁剪后的矩形填充（坐标可为负或越界）
+  * @param  opa: 透明度，255走整字填充，其余走批量混合
+*/
+static void fill_rect_clipped(void *fb, int32_t x, int32_t y, int32_t w, int32_t h,
+                              akiegui_color_t color, uint8_t opa) {
+#if AkieGUI_LCD_BPP == 32 && AKIEGUI_ENABLE_BLEND
+    /* 颜色自带的 alpha 与透明度相乘 */
+    if ((color >> 24) != 0xFF) {
+        opa = (uint8_t)AKIEGUI_DIV255((color >> 24) * opa);
+        color |= 0xFF000000u;
+    }
+#endif
+    if (opa == AKIEGUI_OPA_TRANSP) return;
+
+    int32_t cx0, cy0, cx1, cy1;
+    clip_current(&cx0, &cy0, &cx1, &cy1);
+
+    int32_t x0 = (x > cx0) ? x : cx0;
+    int32_t y0 = (y > cy0) ? y : cy0;
+    int32_t x1 = (x + w < cx1) ? x + w : cx1;
+    int32_t y1 = (y + h < cy1) ? y + h : cy1;
+    if (x1 <= x0 || y1 <= y0) return;
+
+    if (g_akiegui.dl) {
+        akiegui_dl_rect(x0, y0, x1 - x0, y1 - y0, color, opa);
+        return;
+    }
+
+    uint32_t fb_width = g_akiegui.fb_width;
+    uint32_t cw = (uint32_t)(x1 - x0);
+    uint32_t ch = (uint32_t)(y1 - y0);
+
+    /* 大块填充交给加速器，CPU 继续画别的 */
+    if (g_akiegui.gpu &&
+        akiegui_gpu_fill(fb, fb_width * sizeof(akiegui_pixel_t), AKIEGUI_FMT_NATIVE,
+                         x0, y0, (int32_t)cw, (int32_t)ch, color, opa) == 0) {
+        return;
+    }
+    akiegui_gpu_wait_rect(fb, x0, y0, (int32_t)cw, (int32_t)ch);
+
+    akiegui_pixel_t *row = (akiegui_pixel_t*)fb + (uint32_t)y0 * fb_width + x0;
+
+    /* 整行宽度的矩形在显存中是连续的，合并成一次填充 */
+    if (cw == fb_width) {
+        cw *= ch;
+        ch = 1;
+    }
+    for (uint32_t r = 0; r < ch; r++) {
+        if (opa == AKIEGUI_OPA_COVER) {
+            akiegui_fill_span(row, cw, color);
+        } else {
+            akiegui_blend_span(row, cw, color, opa);
+        }
+        row += fb_width;
+    }
+}
+
 /**
   * @brief	矩形绘制
   *	@param	fb: 绘制缓冲区
@@ -29,29 +372,912 @@ void akiegui_draw_rect(
     uint16_t w, uint16_t h,
     akiegui_color_t color
 ) {
-    uint16_t fb_width = g_akiegui.fb_width;
-    
+    if (!fb || w == 0 || h == 0) return;
+    fill_rect_clipped(fb, x, y, w, h, color, g_akiegui.draw_opa);
+}
+
+/**
+  * @brief	半透明矩形绘制
+  *	@param	fb: 绘制缓冲区
+  *	@param	x: 矩形坐标 X
+  *	@param	y: 矩形坐标 Y
+  *	@param	w: 矩形宽度
+  *	@param	h: 矩形高度
+  *	@param	color: 矩形颜色
+  *	@param	opa: 透明度 0~255，再乘以当前绘制透明度
+*/
+void akiegui_draw_rect_opa(
+    void *fb,
+    uint16_t x, uint16_t y,
+    uint16_t w, uint16_t h,
+    akiegui_color_t color,
+    uint8_t opa
+) {
+    if (!fb || w == 0 || h == 0) return;
+    if (g_akiegui.draw_opa != AKIEGUI_OPA_COVER) {
+        opa = (uint8_t)AKIEGUI_DIV255((uint32_t)opa * g_akiegui.draw_opa);
+    }
+    fill_rect_clipped(fb, x, y, w, h, color, opa);
+}
+
+/* ============= 直线、圆、圆弧、圆角矩形 ============= */
+/* 所有图形都拆成水平（或竖直）连续段，经 fill_rect_clipped 整段填充，
+ * 裁剪和透明度都在那里统一处理 */
+
+#if AkieGUI_CIRCLE_CACHE_RADIUS > 255
+#error "AkieGUI_CIRCLE_CACHE_RADIUS 不能超过255"
+#endif
+
+/* 圆的半宽表缓存：界面上通常只有少数几种圆角半径，缓存最近用过的两个（LRU）*/
+static struct {
+    uint16_t r;     /* 0=空 */
+    uint8_t half[AkieGUI_CIRCLE_CACHE_RADIUS + 1];
+} s_circle_cache[2];
+static uint8_t s_circle_next = 0;
+
+/**
+  * @brief	整数平方根（向下取整）
+*/
+static uint32_t isqrt32(uint32_t v) {
+    uint32_t res = 0;
+    uint32_t bit = 1u << 30;
+    while (bit > v) bit >>= 2;
+    while (bit) {
+        if (v >= res + bit) {
+            v -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+/**
+  * @brief	获取半径 r 的半宽表：half[k] 为距圆心 k 行处的水平半宽
+  * @note   判定条件 dx²+dy² <= r²+r（约等于 (r+0.5)²），边缘更圆润
+  * @retval	半宽表，半径超过缓存上限返回NULL（调用者逐行开方）
+*/
+static const uint8_t* circle_table(uint16_t r) {
+    if (r == 0 || r > AkieGUI_CIRCLE_CACHE_RADIUS) return NULL;
+    /* 命中的一项标记为最近使用，圆弧同时取内外两张表时不会互相挤掉 */
+    for (uint8_t i = 0; i < 2; i++) {
+        if (s_circle_cache[i].r == r) {
+            s_circle_next = i ^ 1;
+            return s_circle_cache[i].half;
+        }
+    }
+
+    /* 未命中：替换较早的一项，dx 随 k 单调递减，整表一遍生成 */
+    uint8_t slot = s_circle_next;
+    s_circle_next ^= 1;
+    uint8_t *half = s_circle_cache[slot].half;
+    uint32_t limit = (uint32_t)r * r + r;
+    uint32_t dx = r;
+    for (uint32_t k = 0; k <= r; k++) {
+        while (dx * dx + k * k > limit) dx--;
+        half[k] = (uint8_t)dx;
+    }
+    s_circle_cache[slot].r = r;
+    return half;
+}
+
+/**
+  * @brief	距圆心 k 行处的水平半宽
+*/
+static inline int32_t circle_half(uint16_t r, const uint8_t *tab, int32_t k) {
+    if (tab) return tab[k];
+    return (int32_t)isqrt32((uint32_t)r * r + r - (uint32_t)k * (uint32_t)k);
+}
+
+/**
+  * @brief	水平线段，x0~x1 均包含
+*/
+static inline void span_h(void *fb, int32_t x0, int32_t x1, int32_t y, akiegui_color_t color) {
+    if (x1 >= x0) fill_rect_clipped(fb, x0, y, x1 - x0 + 1, 1, color, g_akiegui.draw_opa);
+}
+
+/**
+  * @brief	圆角填充：四个圆心 (cxl,cyt) (cxr,cyt) (cxl,cyb) (cxr,cyb)，半径 r
+  * @note   圆心之间的部分是整块矩形，只有上下 r 行需要逐行求半宽
+*/
+static void fill_round_corners(void *fb, int32_t cxl, int32_t cyt, int32_t cxr, int32_t cyb,
+                               uint16_t r, akiegui_color_t color) {
+    const uint8_t *tab = circle_table(r);
+
+    fill_rect_clipped(fb, cxl - r, cyt, cxr - cxl + 2 * r + 1, cyb - cyt + 1, color, g_akiegui.draw_opa);
+    for (int32_t k = 1; k <= r; k++) {
+        int32_t hw = circle_half(r, tab, k);
+        span_h(fb, cxl - hw, cxr + hw, cyt - k, color);
+        span_h(fb, cxl - hw, cxr + hw, cyb + k, color);
+    }
+}
+
+/**
+  * @brief	圆角描边（1像素），圆心含义同 fill_round_corners
+  * @note   每行的边框段是 [半宽(k+1)+1, 半宽(k)]，陡峭处为单点，平缓处为一段
+*/
+static void stroke_round_corners(void *fb, int32_t cxl, int32_t cyt, int32_t cxr, int32_t cyb,
+                                 uint16_t r, akiegui_color_t color) {
+    const uint8_t *tab = circle_table(r);
+
+    /* 圆心之间的直边 */
+    if (cyb > cyt) {
+        fill_rect_clipped(fb, cxl - r, cyt + 1, 1, cyb - cyt - 1, color, g_akiegui.draw_opa);
+        if (cxr + r != cxl - r) {
+            fill_rect_clipped(fb, cxr + r, cyt + 1, 1, cyb - cyt - 1, color, g_akiegui.draw_opa);
+        }
+    }
+
+    int32_t hi = circle_half(r, tab, 0);
+    for (int32_t k = 0; k <= r; k++) {
+        int32_t next = (k < r) ? circle_half(r, tab, k + 1) : -1;
+        int32_t lo = (next + 1 < hi) ? next + 1 : hi;
+
+        if (k == r) {
+            /* 最上/最下一行：左右两段与直边连成一整段 */
+            span_h(fb, cxl - hi, cxr + hi, cyt - k, color);
+            if (cyb + k != cyt - k) span_h(fb, cxl - hi, cxr + hi, cyb + k, color);
+        } else {
+            span_h(fb, cxl - hi, cxl - lo, cyt - k, color);
+            span_h(fb, cxr + lo, cxr + hi, cyt - k, color);
+            if (cyb + k != cyt - k) {
+                span_h(fb, cxl - hi, cxl - lo, cyb + k, color);
+                span_h(fb, cxr + lo, cxr + hi, cyb + k, color);
+            }
+        }
+        hi = next;
+    }
+}
+
+/**
+  * @brief	水平线
+  *	@param	fb: 绘制缓冲区
+  *	@param	x: 起点 X
+  *	@param	y: 起点 Y
+  *	@param	w: 长度
+  *	@param	color: 颜色
+*/
+void akiegui_draw_hline(void *fb, int16_t x, int16_t y, uint16_t w, akiegui_color_t color) {
+    if (!fb || w == 0) return;
+    fill_rect_clipped(fb, x, y, w, 1, color, g_akiegui.draw_opa);
+}
+
+/**
+  * @brief	竖直线
+  *	@param	fb: 绘制缓冲区
+  *	@param	x: 起点 X
+  *	@param	y: 起点 Y
+  *	@param	h: 长度
+  *	@param	color: 颜色
+*/
+void akiegui_draw_vline(void *fb, int16_t x, int16_t y, uint16_t h, akiegui_color_t color) {
+    if (!fb || h == 0) return;
+    fill_rect_clipped(fb, x, y, 1, h, color, g_akiegui.draw_opa);
+}
+
+/**
+  * @brief	直线（Bresenham），两端点都包含
+  * @note   平缓的线按行合并成水平段，陡峭的线按列合并成竖直段，每段一次填充
+  *	@param	fb: 绘制缓冲区
+  *	@param	x0: 起点 X
+  *	@param	y0: 起点 Y
+  *	@param	x1: 终点 X
+  *	@param	y1: 终点 Y
+  *	@param	color: 颜色
+*/
+void akiegui_draw_line(void *fb, int16_t x0, int16_t y0, int16_t x1, int16_t y1, akiegui_color_t color) {
+    if (!fb) return;
+
+    /* 与裁剪区没有交集的线直接跳过 */
+    int32_t cx0, cy0, cx1, cy1;
+    clip_current(&cx0, &cy0, &cx1, &cy1);
+    if ((x0 < cx0 && x1 < cx0) || (x0 >= cx1 && x1 >= cx1) ||
+        (y0 < cy0 && y1 < cy0) || (y0 >= cy1 && y1 >= cy1)) return;
+
+    int32_t dx = (x1 > x0) ? x1 - x0 : x0 - x1;
+    int32_t dy = (y1 > y0) ? y1 - y0 : y0 - y1;
+    uint8_t opa = g_akiegui.draw_opa;
+
+    if (dx >= dy) {
+        /* 从左往右，每行一段 */
+        if (x0 > x1) {
+            int16_t t = x0; x0 = x1; x1 = t;
+            t = y0; y0 = y1; y1 = t;
+        }
+        int32_t sy = (y1 > y0) ? 1 : -1;
+        int32_t err = dx / 2;
+        int32_t y = y0;
+        int32_t run_x = x0;
+        for (int32_t x = x0; x <= x1; x++) {
+            err -= dy;
+            if (err < 0 || x == x1) {
+                fill_rect_clipped(fb, run_x, y, x - run_x + 1, 1, color, opa);
+                run_x = x + 1;
+                y += sy;
+                err += dx;
+            }
+        }
+    } else {
+        /* 从上往下，每列一段 */
+        if (y0 > y1) {
+            int16_t t = x0; x0 = x1; x1 = t;
+            t = y0; y0 = y1; y1 = t;
+        }
+        int32_t sx = (x1 > x0) ? 1 : -1;
+        int32_t err = dy / 2;
+        int32_t x = x0;
+        int32_t run_y = y0;
+        for (int32_t y = y0; y <= y1; y++) {
+            err -= dx;
+            if (err < 0 || y == y1) {
+                fill_rect_clipped(fb, x, run_y, 1, y - run_y + 1, color, opa);
+                run_y = y + 1;
+                x += sx;
+                err += dy;
+            }
+        }
+    }
+}
+
+/**
+  * @brief	圆（1像素描边）
+  *	@param	fb: 绘制缓冲区
+  *	@param	cx: 圆心 X
+  *	@param	cy: 圆心 Y
+  *	@param	r: 半径
+  *	@param	color: 颜色
+*/
+void akiegui_draw_circle(void *fb, int16_t cx, int16_t cy, uint16_t r, akiegui_color_t color) {
+    if (!fb) return;
+    stroke_round_corners(fb, cx, cy, cx, cy, r, color);
+}
+
+/**
+  * @brief	实心圆
+  *	@param	fb: 绘制缓冲区
+  *	@param	cx: 圆心 X
+  *	@param	cy: 圆心 Y
+  *	@param	r: 半径
+  *	@param	color: 颜色
+*/
+void akiegui_fill_circle(void *fb, int16_t cx, int16_t cy, uint16_t r, akiegui_color_t color) {
+    if (!fb) return;
+    fill_round_corners(fb, cx, cy, cx, cy, r, color);
+}
+
+/**
+  * @brief	圆角矩形（1像素描边）
+  *	@param	fb: 绘制缓冲区
+  *	@param	x: 矩形坐标 X
+  *	@param	y: 矩形坐标 Y
+  *	@param	w: 矩形宽度
+  *	@param	h: 矩形高度
+  *	@param	r: 圆角半径（超过短边一半时按一半处理）
+  *	@param	color: 颜色
+*/
+void akiegui_draw_round_rect(void *fb, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                             uint16_t r, akiegui_color_t color) {
+    if (!fb || w == 0 || h == 0) return;
+    uint16_t r_max = ((w < h) ? w - 1 : h - 1) / 2;
+    if (r > r_max) r = r_max;
+    stroke_round_corners(fb, x + r, y + r, x + w - 1 - r, y + h - 1 - r, r, color);
+}
+
+/**
+  * @brief	实心圆角矩形
+  *	@param	fb: 绘制缓冲区
+  *	@param	x: 矩形坐标 X
+  *	@param	y: 矩形坐标 Y
+  *	@param	w: 矩形宽度
+  *	@param	h: 矩形高度
+  *	@param	r: 圆角半径（超过短边一半时按一半处理）
+  *	@param	color: 颜色
+*/
+void akiegui_fill_round_rect(void *fb, int16_t x, int16_t y, uint16_t w, uint16_t h,
+                             uint16_t r, akiegui_color_t color) {
+    if (!fb || w == 0 || h == 0) return;
+    uint16_t r_max = ((w < h) ? w - 1 : h - 1) / 2;
+    if (r > r_max) r = r_max;
+    fill_round_corners(fb, x + r, y + r, x + w - 1 - r, y + h - 1 - r, r, color);
+}
+
+/* sin(0°~90°)，Q14 定点 */
+static const int16_t s_sin_q14[91] = {
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+/**
+  * @brief	角度（0~359，度）的 sin，Q14
+*/
+static int32_t sin_q14(int32_t deg) {
+    if (deg < 90)  return s_sin_q14[deg];
+    if (deg < 180) return s_sin_q14[180 - deg];
+    if (deg < 270) return -s_sin_q14[deg - 180];
+    return -s_sin_q14[360 - deg];
+}
+
+/**
+  * @brief	向下取整的整数除法（b > 0）
+*/
+static inline int32_t div_floor(int32_t a, int32_t b) {
+    return (a >= 0) ? a / b : -((-a + b - 1) / b);
+}
+
+/**
+  * @brief	某一行上满足 A*dx <= B 的 dx 范围
+  * @param  lo/hi: 输入输出，与已有范围求交
+*/
+static inline void halfplane_range(int32_t A, int32_t B, int32_t *lo, int32_t *hi) {
+    if (A > 0) {
+        int32_t v = div_floor(B, A);
+        if (v < *hi) *hi = v;
+    } else if (A < 0) {
+        int32_t v = -div_floor(B, -A);      /* ceil(B/A) */
+        if (v > *lo) *lo = v;
+    } else if (B < 0) {
+        *hi = *lo - 1;                      /* 整行都不满足 */
+    }
+}
+
+/**
+  * @brief	把 [a0,a1] 与 [b0,b1] 的交集画成水平段
+*/
+static inline void span_h_and(void *fb, int32_t cx, int32_t y, int32_t a0, int32_t a1,
+                              int32_t b0, int32_t b1, akiegui_color_t color) {
+    int32_t l = (a0 > b0) ? a0 : b0;
+    int32_t h = (a1 < b1) ? a1 : b1;
+    span_h(fb, cx + l, cx + h, y, color);
+}
+
+/**
+  * @brief	圆弧（圆环的一段）
+  * @note   角度按屏幕方向：0°在右侧（3点钟），顺时针增加；起止角相同时画整个圆环。
+  *         起止两条射线各是一个过圆心的半平面，在每一行上就是 dx 的一个区间，
+  *         与圆环的左右两段求交后直接按段填充，不逐像素判断角度
+  *	@param	fb: 绘制缓冲区
+  *	@param	cx: 圆心 X
+  *	@param	cy: 圆心 Y
+  *	@param	r: 外半径
+  *	@param	width: 圆环宽度（不小于半径时为扇形）
+  *	@param	start_angle: 起始角 0~359
+  *	@param	end_angle: 结束角 0~359
+  *	@param	color: 颜色
+*/
+void akiegui_draw_arc(void *fb, int16_t cx, int16_t cy, uint16_t r, uint16_t width,
+                      uint16_t start_angle, uint16_t end_angle, akiegui_color_t color) {
+    if (!fb || width == 0) return;
+    start_angle %= 360;
+    end_angle %= 360;
+
+    int32_t sweep = ((int32_t)end_angle - start_angle + 360) % 360;
+    uint8_t full = (sweep == 0);
+
+    /* 起止方向向量（Q14）*/
+    int32_t sx = sin_q14((start_angle + 90) % 360), sy = sin_q14(start_angle);
+    int32_t ex = sin_q14((end_angle + 90) % 360),   ey = sin_q14(end_angle);
+
+    int32_t ri = (int32_t)r - width;        /* 内半径，<0 表示实心 */
+    const uint8_t *tab_o = circle_table(r);
+    const uint8_t *tab_i = (ri > 0) ? circle_table((uint16_t)ri) : NULL;
+
+    int32_t cx0, cy0, cx1, cy1;
+    clip_current(&cx0, &cy0, &cx1, &cy1);
+
+    for (int32_t dy = -(int32_t)r; dy <= (int32_t)r; dy++) {
+        int32_t y = cy + dy;
+        if (y < cy0 || y >= cy1) continue;
+
+        int32_t k = (dy < 0) ? -dy : dy;
+        int32_t ho = circle_half(r, tab_o, k);
+        int32_t hi = (ri > 0 && k <= ri) ? circle_half((uint16_t)ri, tab_i, k) : -1;
+
+        /* 圆环在这一行的段：hi<0 时是一整段 */
+        int32_t seg[2][2];
+        uint8_t n_seg;
+        if (hi < 0) {
+            seg[0][0] = -ho; seg[0][1] = ho;
+            n_seg = 1;
+        } else {
+            seg[0][0] = -ho;     seg[0][1] = -hi - 1;
+            seg[1][0] = hi + 1;  seg[1][1] = ho;
+            n_seg = 2;
+        }
+
+        /* 这一行的角度允许区间 */
+        int32_t a[2][2];
+        uint8_t n_a;
+        if (full) {
+            a[0][0] = -ho; a[0][1] = ho;
+            n_a = 1;
+        } else if (sweep <= 180) {
+            /* 在起始射线顺时针一侧 且 在结束射线逆时针一侧 */
+            a[0][0] = -ho; a[0][1] = ho;
+            halfplane_range(sy, sx * dy, &a[0][0], &a[0][1]);
+            halfplane_range(-ey, -ex * dy, &a[0][0], &a[0][1]);
+            n_a = 1;
+        } else {
+            /* 大于180°：去掉“结束→起始”这段补弧（开区间）*/
+            int32_t lo = -ho - 1, up = ho + 1;
+            halfplane_range(ey, ex * dy - 1, &lo, &up);
+            halfplane_range(-sy, -sx * dy - 1, &lo, &up);
+            if (lo > up) {
+                a[0][0] = -ho; a[0][1] = ho;
+                n_a = 1;
+            } else {
+                a[0][0] = -ho;   a[0][1] = lo - 1;
+                a[1][0] = up + 1; a[1][1] = ho;
+                n_a = 2;
+            }
+        }
+
+        for (uint8_t i = 0; i < n_seg; i++) {
+            for (uint8_t j = 0; j < n_a; j++) {
+                span_h_and(fb, cx, y, seg[i][0], seg[i][1], a[j][0], a[j][1], color);
+            }
+        }
+    }
+}
+
+/* ============= 单色字模展开 ============= */
+/* 字模位按“高位在前”对应从左到右的像素，掩码表把若干位直接展开成一个64位字里的多个像素，
+ * 第一个像素位于最低地址（小端放在低位，大端放在高位） */
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define GLYPH_LANE(i, n_px, bits)  ((uint64_t)(bits) << ((n_px) - 1 - (i)) * (64 / (n_px)))
+#else
+#define GLYPH_LANE(i, n_px, bits)  ((uint64_t)(bits) << (i) * (64 / (n_px)))
+#endif
+
 #if AkieGUI_LCD_BPP == 16
-    uint16_t *fb16 = (uint16_t*)fb;
-    for (uint16_t row = 0; row < h; row++) {
-        uint32_t base = (y + row) * fb_width + x;
-        for (uint16_t col = 0; col < w; col++) {
-            fb16[base + col] = color;
+/* 4位字模 → 4个RGB565像素的选择掩码 */
+#define GLYPH_MASK16(n) ( \
+    (((n) & 8) ? GLYPH_LANE(0, 4, 0xFFFFu) : 0) | \
+    (((n) & 4) ? GLYPH_LANE(1, 4, 0xFFFFu) : 0) | \
+    (((n) & 2) ? GLYPH_LANE(2, 4, 0xFFFFu) : 0) | \
+    (((n) & 1) ? GLYPH_LANE(3, 4, 0xFFFFu) : 0))
+
+static const uint64_t s_glyph_mask16[16] = {
+    GLYPH_MASK16(0),  GLYPH_MASK16(1),  GLYPH_MASK16(2),  GLYPH_MASK16(3),
+    GLYPH_MASK16(4),  GLYPH_MASK16(5),  GLYPH_MASK16(6),  GLYPH_MASK16(7),
+    GLYPH_MASK16(8),  GLYPH_MASK16(9),  GLYPH_MASK16(10), GLYPH_MASK16(11),
+    GLYPH_MASK16(12), GLYPH_MASK16(13), GLYPH_MASK16(14), GLYPH_MASK16(15),
+};
+
+/**
+  * @brief	把一段字模位写入一行RGB565像素
+  * @param  dst: 第一个像素地址
+  * @param  bits: 字模位（高位对应第一个像素，超出n的位必须为0）
+  * @param  n: 像素个数（不超过32）
+  * @retval	写完后的像素地址
+*/
+static uint16_t* glyph_bits16(uint16_t *dst, uint32_t bits, uint32_t n,
+                              uint16_t color, uint16_t bg_color, uint8_t transparent) {
+    /* 透明背景且剩余全是空白：直接跳过 */
+    if (transparent && bits == 0) return dst + n;
+
+    /* 头部：逐像素写到8字节对齐 */
+    while (n && ((uintptr_t)dst & 7)) {
+        if (bits & 0x80000000u) *dst = color;
+        else if (!transparent) *dst = bg_color;
+        bits <<= 1;
+        dst++;
+        n--;
+    }
+
+    /* 中间：每4个像素查一次掩码表，整字选择前景/背景 */
+    uint64_t fg64 = (uint64_t)color * 0x0001000100010001ull;
+    akiegui_u64_alias_t *d64 = (akiegui_u64_alias_t*)dst;
+    if (transparent) {
+        while (n >= 4) {
+            uint32_t idx = bits >> 28;
+            if (idx == 0xF) {
+                *d64 = fg64;
+            } else if (idx) {
+                uint64_t m = s_glyph_mask16[idx];
+                *d64 = (*d64 & ~m) | (fg64 & m);
+            }
+            bits <<= 4;
+            d64++;
+            n -= 4;
+        }
+    } else {
+        uint64_t bg64 = (uint64_t)bg_color * 0x0001000100010001ull;
+        while (n >= 4) {
+            uint64_t m = s_glyph_mask16[bits >> 28];
+            *d64 = (bg64 & ~m) | (fg64 & m);
+            bits <<= 4;
+            d64++;
+            n -= 4;
         }
     }
-#elif AkieGUI_LCD_BPP == 24 || AkieGUI_LCD_BPP == 32
-    uint32_t *fb32 = (uint32_t*)fb;
-    for (uint16_t row = 0; row < h; row++) {
-        uint32_t base = (y + row) * fb_width + x;
-        for (uint16_t col = 0; col < w; col++) {
-#if AkieGUI_LCD_BPP == 32 && AKIEGUI_ENABLE_BLEND
-            fb32[base + col] = alpha_blend(fb32[base + col], color);
+    dst = (uint16_t*)d64;
+
+    /* 尾部 */
+    while (n) {
+        if (bits & 0x80000000u) *dst = color;
+        else if (!transparent) *dst = bg_color;
+        bits <<= 1;
+        dst++;
+        n--;
+    }
+    return dst;
+}
 #else
-            fb32[base + col] = color;
+#if !(AkieGUI_LCD_BPP == 32 && AKIEGUI_ENABLE_BLEND)
+/* 2位字模 → 2个32位像素的选择掩码（混合模式逐位处理，不用）*/
+#define GLYPH_MASK32(n) ( \
+    (((n) & 2) ? GLYPH_LANE(0, 2, 0xFFFFFFFFu) : 0) | \
+    (((n) & 1) ? GLYPH_LANE(1, 2, 0xFFFFFFFFu) : 0))
+
+static const uint64_t s_glyph_mask32[4] = {
+    GLYPH_MASK32(0), GLYPH_MASK32(1), GLYPH_MASK32(2), GLYPH_MASK32(3),
+};
 #endif
+
+/**
+  * @brief	把一段字模位写入一行32位像素
+  * @param  dst: 第一个像素地址
+  * @param  bits: 字模位（高位对应第一个像素，超出n的位必须为0）
+  * @param  n: 像素个数（不超过32）
+  * @retval	写完后的像素地址
+*/
+static uint32_t* glyph_bits32(uint32_t *dst, uint32_t bits, uint32_t n,
+                              uint32_t color, uint32_t bg_color, uint8_t transparent) {
+    if (transparent && bits == 0) return dst + n;
+
+#if AkieGUI_LCD_BPP == 32 && AKIEGUI_ENABLE_BLEND
+    /* 混合模式需要读回每个像素，逐位处理 */
+    for (; n; n--, bits <<= 1, dst++) {
+        if (bits & 0x80000000u) *dst = alpha_blend(*dst, color);
+        else if (!transparent) *dst = alpha_blend(*dst, bg_color);
+    }
+    return dst;
+#else
+    /* 头部：对齐到8字节 */
+    if (n && ((uintptr_t)dst & 7)) {
+        if (bits & 0x80000000u) *dst = color;
+        else if (!transparent) *dst = bg_color;
+        bits <<= 1;
+        dst++;
+        n--;
+    }
+
+    /* 中间：每2个像素查一次掩码表 */
+    uint64_t fg64 = ((uint64_t)color << 32) | color;
+    akiegui_u64_alias_t *d64 = (akiegui_u64_alias_t*)dst;
+    if (transparent) {
+        while (n >= 2) {
+            uint32_t idx = bits >> 30;
+            if (idx == 0x3) {
+                *d64 = fg64;
+            } else if (idx) {
+                uint64_t m = s_glyph_mask32[idx];
+                *d64 = (*d64 & ~m) | (fg64 & m);
+            }
+            bits <<= 2;
+            d64++;
+            n -= 2;
+        }
+    } else {
+        uint64_t bg64 = ((uint64_t)bg_color << 32) | bg_color;
+        while (n >= 2) {
+            uint64_t m = s_glyph_mask32[bits >> 30];
+            *d64 = (bg64 & ~m) | (fg64 & m);
+            bits <<= 2;
+            d64++;
+            n -= 2;
         }
     }
+    dst = (uint32_t*)d64;
+
+    /* 尾部 */
+    if (n) {
+        if (bits & 0x80000000u) *dst = color;
+        else if (!transparent) *dst = bg_color;
+        dst++;
+    }
+    return dst;
+#endif
+}
+#endif
+
+/**
+  * @brief	按透明度混合展开一段单色字模位（高位在前）
+  * @param  n: 像素个数（不超过32）
+  * @retval	写完后的像素地址
+*/
+static akiegui_pixel_t* glyph_bits_opa(akiegui_pixel_t *dst, uint32_t bits, uint32_t n,
+                                       akiegui_color_t color, akiegui_color_t bg_color,
+                                       uint8_t transparent, uint8_t opa) {
+    for (; n; n--, bits <<= 1, dst++) {
+        if (bits & 0x80000000u) *dst = akiegui_blend(*dst, color, opa);
+        else if (!transparent) *dst = akiegui_blend(*dst, bg_color, opa);
+    }
+    return dst;
+}
+
+/**
+  * @brief	单色点阵字模绘制（逐行式，高位在前），按当前裁剪区裁剪
+  *	@param	fb: 绘制缓冲区
+  *	@param	x: 字模坐标 X
+  *	@param	y: 字模坐标 Y
+  * @param  data: 字模数据
+  * @param  width: 字模宽度
+  * @param  height: 字模高度
+  *	@param	color: 前景颜色
+  *	@param	bg_color: 背景颜色
+  * @param  transparent: 背景是否透明
+  * @param  opa: 透明度，255时按掩码表整字写入
+*/
+static void draw_glyph_1bpp(
+    void *fb,
+    int32_t x, int32_t y,
+    const uint8_t *data,
+    uint16_t width, uint16_t height,
+    akiegui_color_t color,
+    akiegui_color_t bg_color,
+    uint8_t transparent,
+    uint8_t opa
+) {
+    int32_t cx0, cy0, cx1, cy1;
+    clip_current(&cx0, &cy0, &cx1, &cy1);
+
+    /* 可见的字模行列范围 */
+    int32_t c0 = (x < cx0) ? cx0 - x : 0;
+    int32_t r0 = (y < cy0) ? cy0 - y : 0;
+    int32_t c1 = (x + width > cx1) ? cx1 - x : width;
+    int32_t r1 = (y + height > cy1) ? cy1 - y : height;
+    if (c1 <= c0 || r1 <= r0) return;
+    if (g_akiegui.dl) {
+        akiegui_dl_glyph(x, y, data, width, height, 1, color, bg_color, transparent);
+        return;
+    }
+    akiegui_gpu_wait_rect(fb, x + c0, y + r0, c1 - c0, r1 - r0);
+
+    uint32_t fb_width = g_akiegui.fb_width;
+    uint16_t bytes_per_row = (width + 7) / 8;
+
+#if AkieGUI_LCD_BPP == 16
+    uint16_t *row = (uint16_t*)fb + (uint32_t)(y + r0) * fb_width + (x + c0);
+#else
+    uint32_t *row = (uint32_t*)fb + (uint32_t)(y + r0) * fb_width + (x + c0);
+#endif
+    const uint8_t *src = data + r0 * bytes_per_row;
+
+    for (int32_t r = r0; r < r1; r++) {
+#if AkieGUI_LCD_BPP == 16
+        uint16_t *dst = row;
+#else
+        uint32_t *dst = row;
+#endif
+        /* 每次取32列字模位，去掉裁剪掉的列后整段展开 */
+        for (int32_t chunk = c0 & ~31; chunk < c1; chunk += 32) {
+            const uint8_t *p = src + (chunk >> 3);
+            int32_t avail = bytes_per_row - (chunk >> 3);
+            uint32_t bits = (uint32_t)p[0] << 24;
+            if (avail > 1) bits |= (uint32_t)p[1] << 16;
+            if (avail > 2) bits |= (uint32_t)p[2] << 8;
+            if (avail > 3) bits |= (uint32_t)p[3];
+
+            int32_t from = (c0 > chunk) ? c0 : chunk;
+            int32_t to = (c1 < chunk + 32) ? c1 : chunk + 32;
+            uint32_t n = (uint32_t)(to - from);
+            bits <<= (from - chunk);
+            if (n < 32) bits &= ~(0xFFFFFFFFu >> n);
+
+            if (opa != AKIEGUI_OPA_COVER) {
+                dst = glyph_bits_opa(dst, bits, n, color, bg_color, transparent, opa);
+                continue;
+            }
+#if AkieGUI_LCD_BPP == 16
+            dst = glyph_bits16(dst, bits, n, color, bg_color, transparent);
+#else
+            dst = glyph_bits32(dst, bits, n, color, bg_color, transparent);
 #endif
+        }
+        row += fb_width;
+        src += bytes_per_row;
+    }
+}
+
+/* ============= 抗锯齿字模 ============= */
+/* 覆盖度 → 8位透明度 */
+static const uint8_t s_aa_alpha2[4] = { 0, 85, 170, 255 };
+static const uint8_t s_aa_alpha4[16] = {
+    0, 17, 34, 51, 68, 85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255
+};
+
+/**
+  * @brief	一行灰度字模的第 col 个像素
+*/
+static inline void aa_pixel(akiegui_pixel_t *dst, uint8_t v, uint8_t max_level, const uint8_t *alpha_tab,
+                            const akiegui_color_t *ramp, akiegui_color_t color, uint8_t transparent) {
+    if (!transparent) {
+        *dst = ramp[v];
+    } else if (v == max_level) {
+        *dst = color;
+    } else if (v) {
+        *dst = akiegui_blend(*dst, color, alpha_tab[v]);
+    }
+}
+
+/**
+  * @brief	绘制一行灰度字模 [c0, c1)
+  * @note   bpp 以常量传入，编译器可以把整字节的内层循环展开
+*/
+static inline void aa_row(akiegui_pixel_t *dst, const uint8_t *src, int32_t c0, int32_t c1,
+                          const uint8_t bpp, const uint8_t *alpha_tab, const akiegui_color_t *ramp,
+                          akiegui_color_t color, akiegui_color_t bg_color, uint8_t transparent) {
+    const uint8_t px_per_byte = 8 / bpp;
+    const uint8_t shift = (bpp == 4) ? 1 : 2;      /* log2(px_per_byte) */
+    const uint8_t max_level = (uint8_t)((1u << bpp) - 1);
+    int32_t col = c0;
+
+    /* 头部：不在字节边界上的像素 */
+    while (col < c1 && (col & (px_per_byte - 1))) {
+        uint8_t v = (src[col >> shift] >> (8 - bpp - (col & (px_per_byte - 1)) * bpp)) & max_level;
+        aa_pixel(dst++, v, max_level, alpha_tab, ramp, color, transparent);
+        col++;
+    }
+
+    /* 中间：整字节处理，全空白/全覆盖的字节不做混合 */
+    const uint8_t *p = src + (col >> shift);
+    int32_t body_end = c1 & ~(int32_t)(px_per_byte - 1);
+    for (; col < body_end; col += px_per_byte, p++, dst += px_per_byte) {
+        uint8_t byte = *p;
+        if (byte == 0) {
+            if (!transparent) {
+                for (uint8_t k = 0; k < px_per_byte; k++) dst[k] = bg_color;
+            }
+            continue;
+        }
+        if (byte == 0xFF) {
+            for (uint8_t k = 0; k < px_per_byte; k++) dst[k] = color;
+            continue;
+        }
+        for (uint8_t k = 0; k < px_per_byte; k++) {
+            aa_pixel(&dst[k], byte >> (8 - bpp), max_level, alpha_tab, ramp, color, transparent);
+            byte <<= bpp;
+        }
+    }
+
+    /* 尾部 */
+    if (col < c1) {
+        uint8_t byte = *p;
+        for (; col < c1; col++) {
+            aa_pixel(dst++, byte >> (8 - bpp), max_level, alpha_tab, ramp, color, transparent);
+            byte <<= bpp;
+        }
+    }
+}
+
+/**
+  * @brief	2/4位灰度字模绘制（逐行式，高位在前），按当前裁剪区裁剪
+  * @note   覆盖度为0的整字节直接跳过；背景不透明时预先算好每个灰度级的颜色，逐像素只查表
+  *	@param	fb: 绘制缓冲区
+  *	@param	x: 字模坐标 X
+  *	@param	y: 字模坐标 Y
+  * @param  data: 字模数据
+  * @param  width: 字模宽度
+  * @param  height: 字模高度
+  * @param  bpp: 每像素位数（2或4）
+  *	@param	color: 前景颜色
+  *	@param	bg_color: 背景颜色
+  * @param  transparent: 背景是否透明
+  * @param  opa: 透明度
+*/
+static void draw_glyph_aa(
+    void *fb,
+    int32_t x, int32_t y,
+    const uint8_t *data,
+    uint16_t width, uint16_t height,
+    uint8_t bpp,
+    akiegui_color_t color,
+    akiegui_color_t bg_color,
+    uint8_t transparent,
+    uint8_t opa
+) {
+    int32_t cx0, cy0, cx1, cy1;
+    clip_current(&cx0, &cy0, &cx1, &cy1);
+
+    int32_t c0 = (x < cx0) ? cx0 - x : 0;
+    int32_t r0 = (y < cy0) ? cy0 - y : 0;
+    int32_t c1 = (x + width > cx1) ? cx1 - x : width;
+    int32_t r1 = (y + height > cy1) ? cy1 - y : height;
+    if (c1 <= c0 || r1 <= r0) return;
+    if (g_akiegui.dl) {
+        akiegui_dl_glyph(x, y, data, width, height, bpp, color, bg_color, transparent);
+        return;
+    }
+    akiegui_gpu_wait_rect(fb, x + c0, y + r0, c1 - c0, r1 - r0);
+
+    const uint8_t *alpha_tab = (bpp == 4) ? s_aa_alpha4 : s_aa_alpha2;
+    uint8_t max_level = (uint8_t)((1u << bpp) - 1);
+
+    /* 不透明背景：每个灰度级的最终颜色只算一次 */
+    akiegui_color_t ramp[16];
+    if (!transparent) {
+        for (uint8_t v = 0; v <= max_level; v++) {
+            ramp[v] = akiegui_blend(bg_color, color, alpha_tab[v]);
+        }
+    }
+
+    uint32_t fb_width = g_akiegui.fb_width;
+    uint16_t bytes_per_row = (uint16_t)(((uint32_t)width * bpp + 7) / 8);
+    akiegui_pixel_t *row = (akiegui_pixel_t*)fb + (uint32_t)(y + r0) * fb_width + (x + c0);
+    const uint8_t *src = data + r0 * bytes_per_row;
+
+    /* 半透明：覆盖度先乘上透明度，逐像素混合到显存 */
+    if (opa != AKIEGUI_OPA_COVER) {
+        uint8_t alpha_opa[16];
+        for (uint8_t v = 0; v <= max_level; v++) {
+            alpha_opa[v] = (uint8_t)AKIEGUI_DIV255((uint32_t)alpha_tab[v] * opa);
+        }
+        uint8_t px_mask = (uint8_t)(8 / bpp - 1);
+        uint8_t shift = (bpp == 4) ? 1 : 2;
+        for (int32_t r = r0; r < r1; r++, row += fb_width, src += bytes_per_row) {
+            akiegui_pixel_t *dst = row;
+            for (int32_t col = c0; col < c1; col++, dst++) {
+                uint8_t v = (src[col >> shift] >> (8 - bpp - (col & px_mask) * bpp)) & max_level;
+                if (!transparent) *dst = akiegui_blend(*dst, ramp[v], opa);
+                else if (v) *dst = akiegui_blend(*dst, color, alpha_opa[v]);
+            }
+        }
+        return;
+    }
+
+    for (int32_t r = r0; r < r1; r++) {
+        if (bpp == 4) {
+            aa_row(row, src, c0, c1, 4, alpha_tab, ramp, color, bg_color, transparent);
+        } else {
+            aa_row(row, src, c0, c1, 2, alpha_tab, ramp, color, bg_color, transparent);
+        }
+        row += fb_width;
+        src += bytes_per_row;
+    }
+}
+
+/**
+  * @brief	字模位图绘制（按当前绘制透明度）
+  *	@param	fb: 绘制缓冲区
+  *	@param	x: 字模坐标 X
+  *	@param	y: 字模坐标 Y
+  * @param  data: 字模数据
+  * @param  width: 字模宽度
+  * @param  height: 字模高度
+  * @param  bpp: 每像素位数（1、2、4）
+  *	@param	color: 前景颜色
+  *	@param	bg_color: 背景颜色
+  * @param  transparent: 背景是否透明
+*/
+void akiegui_draw_glyph(
+    void *fb,
+    int16_t x, int16_t y,
+    const uint8_t *data,
+    uint16_t width, uint16_t height,
+    uint8_t bpp,
+    akiegui_color_t color,
+    akiegui_color_t bg_color,
+    uint8_t transparent
+) {
+    if (!fb || !data) return;
+    if (bpp == 2 || bpp == 4) {
+        draw_glyph_aa(fb, x, y, data, width, height, bpp,
+                      color, bg_color, transparent, g_akiegui.draw_opa);
+    } else {
+        draw_glyph_1bpp(fb, x, y, data, width, height,
+                        color, bg_color, transparent, g_akiegui.draw_opa);
+    }
 }
 
 /**
@@ -74,61 +1300,16 @@ void akiegui_draw_char(
     uint8_t transparent,
     pFONT *font
 ) {
-    if (!font || !font->pTable || ch < 32 || ch > 126) return;
-    
-    uint16_t fb_width = g_akiegui.fb_width;
-    uint16_t offset = (ch - 32) * font->Sizes;
-    uint8_t bytes_per_row = (font->Width + 7) / 8;
-    
-#if AkieGUI_LCD_BPP == 16
-    uint16_t *fb16 = (uint16_t*)fb;
-    for (uint8_t row = 0; row < font->Height; row++) {
-        for (uint8_t byte = 0; byte < bytes_per_row; byte++) {
-            uint8_t data = font->pTable[offset + row * bytes_per_row + byte];
-            uint8_t start_col = byte * 8;
-            
-            for (uint8_t bit = 0; bit < 8; bit++) {
-                uint8_t col = start_col + bit;
-                if (col >= font->Width) break;
-                
-                uint32_t fb_idx = (y + row) * fb_width + (x + col);
-                if (data & (1 << (7 - bit))) {
-                    fb16[fb_idx] = color;
-                } else if (!transparent) {
-                    fb16[fb_idx] = bg_color;
-                }
-            }
-        }
-    }
-#elif AkieGUI_LCD_BPP == 24 || AkieGUI_LCD_BPP == 32
-    uint32_t *fb32 = (uint32_t*)fb;
-    for (uint8_t row = 0; row < font->Height; row++) {
-        for (uint8_t byte = 0; byte < bytes_per_row; byte++) {
-            uint8_t data = font->pTable[offset + row * bytes_per_row + byte];
-            uint8_t start_col = byte * 8;
-            
-            for (uint8_t bit = 0; bit < 8; bit++) {
-                uint8_t col = start_col + bit;
-                if (col >= font->Width) break;
-                
-                uint32_t fb_idx = (y + row) * fb_width + (x + col);
-                if (data & (1 << (7 - bit))) {
-#if AkieGUI_LCD_BPP == 32 && AKIEGUI_ENABLE_BLEND
-                    fb32[fb_idx] = alpha_blend(fb32[fb_idx], color);
-#else
-                    fb32[fb_idx] = color;
-#endif
-                } else if (!transparent) {
-#if AkieGUI_LCD_BPP == 32 && AKIEGUI_ENABLE_BLEND
-                    fb32[fb_idx] = alpha_blend(fb32[fb_idx], bg_color);
-#else
-                    fb32[fb_idx] = bg_color;
-#endif
-                }
-            }
-        }
+    if (!fb || !font || !font->pTable || ch < 32 || ch > 126) return;
+
+    const uint8_t *char_data = font->pTable + (uint32_t)(ch - 32) * font->Sizes;
+    if (font->Bpp == 2 || font->Bpp == 4) {
+        draw_glyph_aa(fb, x, y, char_data, font->Width, font->Height, font->Bpp,
+                      color, bg_color, transparent, g_akiegui.draw_opa);
+    } else {
+        draw_glyph_1bpp(fb, x, y, char_data, font->Width, font->Height,
+                        color, bg_color, transparent, g_akiegui.draw_opa);
     }
-#endif
 }
 
 /**
@@ -151,94 +1332,17 @@ void akiegui_draw_chinese_char(
     uint8_t transparent,
     pFONT *font                 /* 中文字体 */
 ){
-    if (ch == NULL || font == NULL) return;
-    // 字符编码到字库索引的映射
-    uint16_t char_index = 0;
-    uint16_t fb_idx = 0;
-#if AkieGUI_LCD_BPP == 16
-    uint16_t *fb16 = (uint16_t*)fb;
-    while(1)
-	{		
-		// 通过对比数组中的汉字编码，定位字模地址
-		if ( *(font->pTable + (fb_index+1)*font->Sizes + 0)==*ch && *(font->pTable + (fb_index+1)*font->Sizes + 1)==*(ch+1) )	
-		{
-		  char_index=fb_index;	// 字模地址偏移
-		  break;
-		}				
-		fb_index+=2;	// 每个中文字符占两字节
-
-		if(fb_index >= font->Table_Rows)	return;	// 字模列表没这个字
-	}
-    fb_index = 0;
-    // 计算字模数据偏移量
-    const uint8_t* char_data = font->pTable + char_index * font->Sizes;
-    // 计算每行需要的字节数
-    uint8_t bytes_per_row = (font->Width + 7) / 8;
-    // 遍历每一行
-    for (uint8_t row = 0; row < font->Height; row++) {
-        for (uint8_t byte_idx = 0; byte_idx < bytes_per_row; byte_idx++) {
-            uint8_t line_byte = char_data[row * bytes_per_row + byte_idx];
-            uint8_t start_col = byte_idx * 8;
-
-            for (uint8_t bit = 0; bit < 8; bit++) {
-                uint8_t col = start_col + bit;
-                if (col >= font->Width) break;
-
-                fb_index = (y + row) * g_akiegui.fb_width + (x + col);
-                if (line_byte & (1 << (7 - bit))) {
-                   fb16[fb_index] = color;
-                } else if (!transparent) {
-                    fb16[fb_index] = bg_color;
-                }
-            }
-        }
-    }
-#elif AkieGUI_LCD_BPP == 24 || AkieGUI_LCD_BPP == 32
-    uint32_t *fb32 = (uint32_t*)fb;
-    while(1)
-	{		
-		// 通过对比数组中的汉字编码，定位字模地址
-		if ( *(font->pTable + (fb_idx+1)*font->Sizes + 0)==*ch && *(font->pTable + (fb_idx+1)*font->Sizes + 1)==*(ch+1) )	
-		{
-		  char_index=fb_idx;	// 字模地址偏移
-		  break;
-		}				
-		fb_idx+=2;	// 每个中文字符占两字节
-		if(fb_idx >= font->Table_Rows)	return;	// 字模列表没这个字
-	}
-    fb_idx = 0;
-    // 计算字模数据偏移量
-    const uint8_t* char_data = font->pTable + char_index * font->Sizes;
-    // 计算每行需要的字节数
-    uint8_t bytes_per_row = (font->Width + 7) / 8;
-    // 遍历每一行
-    for (uint8_t row = 0; row < font->Height; row++) {
-        for (uint8_t byte_idx = 0; byte_idx < bytes_per_row; byte_idx++) {
-            uint8_t line_byte = char_data[row * bytes_per_row + byte_idx];
-            uint8_t start_col = byte_idx * 8;
-
-            for (uint8_t bit = 0; bit < 8; bit++) {
-                uint8_t col = start_col + bit;
-                if (col >= font->Width) break;
-
-                fb_idx = (y + row) * g_akiegui.fb_width + (x + col);
-                if (line_byte & (1 << (7 - bit))) {
-#if AkieGUI_LCD_BPP == 32 && AKIEGUI_ENABLE_BLEND
-                    fb32[fb_idx] = alpha_blend(fb32[fb_idx], color);
-#else
-                    fb32[fb_idx] = color;
-#endif
-                } else if (!transparent) {
-#if AkieGUI_LCD_BPP == 32 && AKIEGUI_ENABLE_BLEND
-                    fb32[fb_idx] = alpha_blend(fb32[fb_idx], bg_color);
-#else
-                    fb32[fb_idx] = bg_color;
-#endif
-                }
-            }
-        }
+    if (!fb || ch == NULL || font == NULL || !font->pTable) return;
+
+    const uint8_t *char_data = akiegui_font_find_glyph(font, ch);
+    if (!char_data) return;
+    if (font->Bpp == 2 || font->Bpp == 4) {
+        draw_glyph_aa(fb, x, y, char_data, font->Width, font->Height, font->Bpp,
+                      color, bg_color, transparent, g_akiegui.draw_opa);
+    } else {
+        draw_glyph_1bpp(fb, x, y, char_data, font->Width, font->Height,
+                        color, bg_color, transparent, g_akiegui.draw_opa);
     }
-    #endif
 }
 
 /**
@@ -262,10 +1366,15 @@ void akiegui_draw_string(
     pFONT *font
 ) {
     if (!str || !font) return;
-    
-    uint16_t cur_x = x;
-    while (*str) {
-        akiegui_draw_char(fb, cur_x, y, *str, color, bg_color, transparent, font);
+
+    int32_t cx0, cy0, cx1, cy1;
+    clip_current(&cx0, &cy0, &cx1, &cy1);
+
+    int32_t cur_x = x;
+    while (*str && cur_x < cx1) {
+        if (cur_x + font->Width > cx0) {
+            akiegui_draw_char(fb, (uint16_t)cur_x, y, *str, color, bg_color, transparent, font);
+        }
         cur_x += font->Width;
         str++;
     }
@@ -293,17 +1402,26 @@ void akiegui_draw_chinese_string(
     pFONT *chinese_font,
     pFONT *ascii_font
 ) {
-    uint16_t cur_x = x;
-    while (*str != '\0') {
+    if (!str || !chinese_font || !ascii_font) return;
+
+    int32_t cx0, cy0, cx1, cy1;
+    clip_current(&cx0, &cy0, &cx1, &cy1);
+
+    int32_t cur_x = x;
+    while (*str != '\0' && cur_x < cx1) {
         if ((uint8_t)*str >= 0xA1 && (uint8_t)*str <= 0xF7) {
             // GB2312 中文字符
             if (*(str + 1) == '\0') break;
-            akiegui_draw_chinese_char(fb, cur_x, y, str, color, bg_color, transparent, chinese_font);
+            if (cur_x + chinese_font->Width > cx0) {
+                akiegui_draw_chinese_char(fb, (uint16_t)cur_x, y, str, color, bg_color, transparent, chinese_font);
+            }
             cur_x += chinese_font->Width;
             str += 2;
         } else if (*str >= 0x20 && *str <= 0x7E) {
             // ASCII
-            akiegui_draw_char(fb, cur_x, y, *str, color, bg_color, transparent, ascii_font);
+            if (cur_x + ascii_font->Width > cx0) {
+                akiegui_draw_char(fb, (uint16_t)cur_x, y, *str, color, bg_color, transparent, ascii_font);
+            }
             cur_x += ascii_font->Width;
             str++;
         } else {
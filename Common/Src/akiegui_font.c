@@ -0,0 +1,116 @@
+/* ============= akiegui_font.c ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 字体基类部分
+ *
+ * 汉字字模查找：
+ *   - FONT_TYPE_GB2312：按区位码直接计算字模序号
+ *   - FONT_TYPE_GBK：按编码索引二分查找，索引可静态给出或首次使用时生成
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#include "akiegui_font.h"
+#include "akiegui_memory.h"
+#include <stddef.h>
+
+/* 索引生成失败的标记，避免每次绘制都重新尝试分配 */
+static const pFONT_INDEX s_index_unavailable = { 0, 0 };
+
+/**
+  * @brief	生成汉字编码索引
+  * @note   只用于“字模行、编码行”交替排列的字库，索引从内存池分配，生成一次即可
+  * @param  font: 中文字体
+  * @retval	0成功 -1失败
+*/
+int akiegui_font_build_index(pFONT *font) {
+    if (!font || !font->pTable || font->Sizes < 2) return -1;
+    if (font->pIndex && font->pIndex != &s_index_unavailable) return 0;
+
+    uint16_t count = font->Table_Rows / 2;
+    if (count == 0) return -1;
+
+    pFONT_INDEX *index = (pFONT_INDEX*)AkieGUI_MemAllocTag(count * sizeof(pFONT_INDEX), AkieGUI_MEM_TAG_FONT);
+    if (!index) {
+        font->pIndex = &s_index_unavailable;
+        font->Index_Count = 0;
+        return -1;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        const uint8_t *code = font->pTable + (uint32_t)(2 * i + 1) * font->Sizes;
+        index[i].Code = ((uint16_t)code[0] << 8) | code[1];
+        index[i].Glyph = i;
+    }
+
+    /* 希尔排序：字库工具输出的字序通常接近有序，几乎是线性时间 */
+    for (uint16_t gap = count / 2; gap > 0; gap /= 2) {
+        for (uint16_t i = gap; i < count; i++) {
+            pFONT_INDEX tmp = index[i];
+            uint16_t j = i;
+            while (j >= gap && index[j - gap].Code > tmp.Code) {
+                index[j] = index[j - gap];
+                j -= gap;
+            }
+            index[j] = tmp;
+        }
+    }
+
+    font->pIndex = index;
+    font->Index_Count = count;
+    return 0;
+}
+
+/**
+  * @brief	查找GB2312字符的字模
+  * @param  font: 中文字体
+  * @param  ch: GB2312双字节
+  * @retval	字模数据指针，字库中没有该字返回NULL
+*/
+const uint8_t* akiegui_font_find_glyph(pFONT *font, const char *ch) {
+    if (!font || !font->pTable || !ch) return NULL;
+
+    uint8_t hi = (uint8_t)ch[0];
+    uint8_t lo = (uint8_t)ch[1];
+
+    /* 完整GB2312字库：区位码直接定位 */
+    if (font->FontType == FONT_TYPE_GB2312) {
+        if (hi < 0xA1 || hi > 0xF7 || lo < 0xA1 || lo > 0xFE) return NULL;
+        uint32_t glyph = (uint32_t)(hi - 0xA1) * 94 + (lo - 0xA1);
+        if (glyph >= font->Table_Rows) return NULL;
+        return font->pTable + glyph * font->Sizes;
+    }
+
+    if (!font->pIndex) {
+        akiegui_font_build_index(font);
+    }
+
+    /* 有索引：二分查找 */
+    if (font->Index_Count > 0) {
+        uint16_t code = ((uint16_t)hi << 8) | lo;
+        uint16_t left = 0;
+        uint16_t right = font->Index_Count;
+        while (left < right) {
+            uint16_t mid = left + (right - left) / 2;
+            uint16_t mid_code = font->pIndex[mid].Code;
+            if (mid_code == code) {
+                return font->pTable + (uint32_t)font->pIndex[mid].Glyph * 2 * font->Sizes;
+            }
+            if (mid_code < code) left = mid + 1;
+            else right = mid;
+        }
+        return NULL;
+    }
+
+    /* 索引不可用（内存不足）：退回逐项比较 */
+    for (uint32_t idx = 0; idx < font->Table_Rows; idx += 2) {
+        const uint8_t *code = font->pTable + (idx + 1) * font->Sizes;
+        if (code[0] == hi && code[1] == lo) {
+            return font->pTable + idx * font->Sizes;
+        }
+    }
+    return NULL;    // 字模列表没这个字
+}
@@ -0,0 +1,259 @@
+/* ============= akiegui_gpu.c ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 2D加速器调度部分
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#include "akiegui_gpu.h"
+#include "akiegui_blit.h"
+#include "akiegui_blend.h"
+#include "akiegui_draw.h"
+#include <stddef.h>
+
+/**
+  * @brief	设置加速器操作表
+  * @param  ops: 操作表，NULL为关闭加速器
+*/
+void AkieGUI_GPU_SetOps(const AkieGUI_GPU_Ops_T *ops) {
+    AkieGUI_GPU_Sync();
+    g_akiegui.gpu = ops;
+}
+
+/**
+  * @brief	提交一个操作，并把目标区域并入未完成包围盒
+  * @retval	0已接受 -1未接受
+*/
+static int gpu_submit(int (*op)(const AkieGUI_GPU_Job_T *), const AkieGUI_GPU_Job_T *job,
+                      const void *base, int32_t x, int32_t y, int32_t w, int32_t h) {
+    if (!op || (uint32_t)w * (uint32_t)h < AkieGUI_GPU_MIN_PIXELS) return -1;
+
+    /* 加速器也不能改还没发到屏幕的像素 */
+    AkieGUI_Xfer_WaitRect(base, x, y, w, h);
+
+    /* 只跟踪一个目标缓冲区：换了缓冲区先等之前的做完 */
+    if (g_akiegui.gpu_completed != g_akiegui.gpu_submitted && g_akiegui.gpu_base != base) {
+        AkieGUI_GPU_Sync();
+    }
+
+    AkieGUI_Rect_T *b = &g_akiegui.gpu_dirty;
+    if (g_akiegui.gpu_completed == g_akiegui.gpu_submitted) {
+        g_akiegui.gpu_base = base;
+        b->x = (uint16_t)x;
+        b->y = (uint16_t)y;
+        b->w = (uint16_t)w;
+        b->h = (uint16_t)h;
+    } else {
+        int32_t x0 = (x < b->x) ? x : b->x;
+        int32_t y0 = (y < b->y) ? y : b->y;
+        int32_t x1 = (x + w > b->x + b->w) ? x + w : b->x + b->w;
+        int32_t y1 = (y + h > b->y + b->h) ? y + h : b->y + b->h;
+        b->x = (uint16_t)x0;
+        b->y = (uint16_t)y0;
+        b->w = (uint16_t)(x1 - x0);
+        b->h = (uint16_t)(y1 - y0);
+    }
+
+    /* 先计数再提交：完成中断可能在 op 返回之前就到来 */
+    g_akiegui.gpu_submitted++;
+    if (op(job) != 0) {
+        g_akiegui.gpu_submitted--;
+        return -1;
+    }
+    return 0;
+}
+
+/**
+  * @brief	提交单色填充
+  *	@param	base: 目标缓冲区（帧缓冲）
+  *	@param	stride: 目标每行字节数
+  *	@param	format: 目标格式
+  *	@param	x/y/w/h: 已裁剪的填充区域
+  *	@param	color: 颜色（目标格式）
+  *	@param	opa: 透明度
+  * @retval	0已交给加速器 -1需要软件完成
+*/
+int akiegui_gpu_fill(
+    void *base, uint32_t stride, uint8_t format,
+    int32_t x, int32_t y, int32_t w, int32_t h,
+    uint32_t color, uint8_t opa
+) {
+    const AkieGUI_GPU_Ops_T *ops = g_akiegui.gpu;
+    if (!ops) return -1;
+
+    AkieGUI_GPU_Job_T job = {
+        .dst = (uint8_t*)base + (uint32_t)y * stride + (uint32_t)x * akiegui_fmt_bytes(format),
+        .src = NULL,
+        .dst_stride = stride,
+        .src_stride = 0,
+        .w = (uint16_t)w,
+        .h = (uint16_t)h,
+        .dst_format = format,
+        .src_format = format,
+        .opa = opa,
+        .color = color,
+    };
+    return gpu_submit(ops->fill, &job, base, x, y, w, h);
+}
+
+/**
+  * @brief	提交像素块搬运
+  * @note   复制→copy/convert，按 alpha 混合→blend
+  *	@param	base: 目标缓冲区
+  *	@param	stride: 目标每行字节数
+  *	@param	format: 目标格式
+  *	@param	x/y/w/h: 已裁剪的目标区域
+  *	@param	src: 源第一个像素
+  *	@param	src_stride: 源每行字节数
+  *	@param	src_format: 源格式
+  *	@param	mode: 搬运模式
+  *	@param	opa: 整体透明度
+  * @retval	0已交给加速器 -1需要软件完成
+*/
+int akiegui_gpu_blit(
+    void *base, uint32_t stride, uint8_t format,
+    int32_t x, int32_t y, int32_t w, int32_t h,
+    const void *src, uint32_t src_stride, uint8_t src_format,
+    uint8_t mode, uint8_t opa
+) {
+    const AkieGUI_GPU_Ops_T *ops = g_akiegui.gpu;
+    if (!ops) return -1;
+
+    /* 关键色、预乘、带透明度的复制（不看源 alpha）交给软件 */
+    int (*op)(const AkieGUI_GPU_Job_T *) = NULL;
+    if (mode == AKIEGUI_BLIT_ALPHA) {
+        op = ops->blend;
+    } else if (mode == AKIEGUI_BLIT_COPY && opa == AKIEGUI_OPA_COVER) {
+        op = (src_format == format) ? ops->copy : ops->convert;
+    }
+    if (!op) return -1;
+
+    AkieGUI_GPU_Job_T job = {
+        .dst = (uint8_t*)base + (uint32_t)y * stride + (uint32_t)x * akiegui_fmt_bytes(format),
+        .src = src,
+        .dst_stride = stride,
+        .src_stride = src_stride,
+        .w = (uint16_t)w,
+        .h = (uint16_t)h,
+        .dst_format = format,
+        .src_format = src_format,
+        .opa = opa,
+        .color = 0,
+    };
+    return gpu_submit(op, &job, base, x, y, w, h);
+}
+
+/* ============= 软件参考实现 ============= */
+
+#define SOFT_FILL     0
+#define SOFT_COPY     1
+#define SOFT_BLEND    2
+
+static struct {
+    AkieGUI_GPU_Job_T job;
+    uint8_t kind;
+} s_soft_queue[AkieGUI_GPU_SOFT_QUEUE];
+static volatile uint8_t s_soft_head = 0;     /* 下一个要执行的 */
+static volatile uint8_t s_soft_count = 0;    /* 队列中的个数 */
+
+/**
+  * @brief	操作入队，队列满时拒绝（由调用者用软件完成）
+*/
+static int soft_enqueue(const AkieGUI_GPU_Job_T *job, uint8_t kind) {
+    uint32_t primask;
+    int ret = -1;
+
+    AkieGUI_ENTER_CRITICAL(primask);
+    if (s_soft_count < AkieGUI_GPU_SOFT_QUEUE) {
+        uint8_t tail = (uint8_t)((s_soft_head + s_soft_count) % AkieGUI_GPU_SOFT_QUEUE);
+        s_soft_queue[tail].job = *job;
+        s_soft_queue[tail].kind = kind;
+        s_soft_count++;
+        ret = 0;
+    }
+    AkieGUI_EXIT_CRITICAL(primask);
+    return ret;
+}
+
+static int soft_fill(const AkieGUI_GPU_Job_T *job) {
+    /* 填充内核按帧缓冲格式工作 */
+    if (job->dst_format != AKIEGUI_FMT_NATIVE) return -1;
+    return soft_enqueue(job, SOFT_FILL);
+}
+
+static int soft_copy(const AkieGUI_GPU_Job_T *job) {
+    return soft_enqueue(job, SOFT_COPY);
+}
+
+static int soft_blend(const AkieGUI_GPU_Job_T *job) {
+    return soft_enqueue(job, SOFT_BLEND);
+}
+
+static void soft_wait(void) {
+    akiegui_gpu_soft_process(1);
+}
+
+/**
+  * @brief	用CPU执行一个操作
+*/
+static void soft_execute(const AkieGUI_GPU_Job_T *job, uint8_t kind) {
+    if (kind == SOFT_FILL) {
+        uint8_t *row = (uint8_t*)job->dst;
+        for (uint16_t r = 0; r < job->h; r++, row += job->dst_stride) {
+            if (job->opa == AKIEGUI_OPA_COVER) {
+                akiegui_fill_span(row, job->w, (akiegui_color_t)job->color);
+            } else {
+                akiegui_blend_span(row, job->w, (akiegui_color_t)job->color, job->opa);
+            }
+        }
+        return;
+    }
+
+    AkieGUI_Surface_T dst = {
+        .data = job->dst, .w = job->w, .h = job->h,
+        .stride = job->dst_stride, .format = job->dst_format,
+    };
+    AkieGUI_Surface_T src = {
+        .data = (void*)job->src, .w = job->w, .h = job->h,
+        .stride = job->src_stride, .format = job->src_format,
+    };
+    akiegui_blit_cpu(&dst, 0, 0, &src, NULL,
+                     (kind == SOFT_BLEND) ? AKIEGUI_BLIT_ALPHA : AKIEGUI_BLIT_COPY, job->opa, 0);
+}
+
+/**
+  * @brief	执行软件加速器队列中的操作
+  * @note   可在主循环、定时器或另一个线程中调用；每完成一个操作调用一次 AkieGUI_GPU_Complete()
+  * @param  max_jobs: 最多执行的个数，0为全部
+  * @retval	执行的个数
+*/
+uint32_t akiegui_gpu_soft_process(uint32_t max_jobs) {
+    uint32_t done = 0;
+    while (s_soft_count && (max_jobs == 0 || done < max_jobs)) {
+        /* 执行期间槽位仍被占用，执行完才出队 */
+        soft_execute(&s_soft_queue[s_soft_head].job, s_soft_queue[s_soft_head].kind);
+
+        uint32_t primask;
+        AkieGUI_ENTER_CRITICAL(primask);
+        s_soft_head = (uint8_t)((s_soft_head + 1) % AkieGUI_GPU_SOFT_QUEUE);
+        s_soft_count--;
+        AkieGUI_EXIT_CRITICAL(primask);
+
+        AkieGUI_GPU_Complete();
+        done++;
+    }
+    return done;
+}
+
+/* 软件参考实现的操作表：用 AkieGUI_GPU_SetOps(&AkieGUI_GPU_SoftOps) 启用 */
+const AkieGUI_GPU_Ops_T AkieGUI_GPU_SoftOps = {
+    .fill = soft_fill,
+    .copy = soft_copy,
+    .blend = soft_blend,
+    .convert = soft_copy,
+    .wait = soft_wait,
+};
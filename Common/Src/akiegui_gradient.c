@@ -0,0 +1,294 @@
+/* ============= akiegui_gradient.c ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 渐变填充部分
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#include "akiegui_gradient.h"
+#include "akiegui_blend.h"
+#include "akiegui_draw.h"
+#include "akiegui_gpu.h"
+#include "akiegui_dlist.h"
+#include <string.h>
+
+#if AkieGUI_LCD_BPP == 16
+typedef uint16_t akiegui_pixel_t;
+#define GRAD_DITHER     AkieGUI_GRAD_DITHER
+#else
+typedef uint32_t akiegui_pixel_t;
+#define GRAD_DITHER     0
+#endif
+
+#if GRAD_DITHER
+/* 4x4 Bayer 矩阵（0~15），按 (y&3, x&3) 取阈值 */
+static const uint8_t s_bayer4[4][4] = {
+    {  0,  8,  2, 10 },
+    { 12,  4, 14,  6 },
+    {  3, 11,  1,  9 },
+    { 15,  7, 13,  5 },
+};
+#endif
+
+/* 径向渐变颜色表（RGB888），按端点颜色缓存 */
+static uint32_t s_radial_lut[256];
+static uint32_t s_radial_c0 = 0, s_radial_c1 = 0;
+static uint8_t s_radial_valid = 0;
+
+/**
+  * @brief	8位通道颜色转本地格式
+  *	@param	d: 抖动阈值 0~15（不抖动时忽略）
+*/
+static inline akiegui_color_t grad_pack(uint32_t r, uint32_t g, uint32_t b, uint32_t d) {
+#if GRAD_DITHER
+    /* 加上被截掉的低位范围内的阈值再截断：R、B 丢3位（0~7），G 丢2位（0~3）*/
+    r += d >> 1;
+    g += d >> 2;
+    b += d >> 1;
+    if (r > 255) r = 255;
+    if (g > 255) g = 255;
+    if (b > 255) b = 255;
+#else
+    (void)d;
+#endif
+    return akiegui_argb888_to_native(0xFF000000u | (r << 16) | (g << 8) | b);
+}
+
+/**
+  * @brief	裁剪目标矩形，并等待与之重叠的加速器操作
+  * @retval	0有可见部分 -1完全不可见 1有可见部分但正在录制显示列表
+*/
+static int grad_clip(void *fb, int32_t x, int32_t y, int32_t w, int32_t h,
+                     int32_t *x0, int32_t *y0, int32_t *x1, int32_t *y1) {
+    if (!fb || w <= 0 || h <= 0 || g_akiegui.draw_opa == AKIEGUI_OPA_TRANSP) return -1;
+
+    AkieGUI_Rect_T clip;
+    akiegui_clip_get(&clip);
+    *x0 = (x > clip.x) ? x : clip.x;
+    *y0 = (y > clip.y) ? y : clip.y;
+    *x1 = (x + w < clip.x + clip.w) ? x + w : clip.x + clip.w;
+    *y1 = (y + h < clip.y + clip.h) ? y + h : clip.y + clip.h;
+    if (*x1 <= *x0 || *y1 <= *y0) return -1;
+    if (g_akiegui.dl) return 1;
+
+    akiegui_gpu_wait_rect(fb, *x0, *y0, *x1 - *x0, *y1 - *y0);
+    return 0;
+}
+
+/**
+  * @brief	把 c0→c1 的每通道增量（16.16定点）算出来
+  *	@param	len: 渐变长度（像素），两端都包含
+  *	@param	start: 从第几个像素开始
+  *	@param	acc: 输出起始值 [r, g, b]
+  *	@param	step: 输出每像素增量 [r, g, b]
+*/
+static void grad_setup(uint32_t c0, uint32_t c1, int32_t len, int32_t start,
+                       int32_t acc[3], int32_t step[3]) {
+    for (int i = 0; i < 3; i++) {
+        int32_t a = (int32_t)((c0 >> (16 - 8 * i)) & 0xFF);
+        int32_t b = (int32_t)((c1 >> (16 - 8 * i)) & 0xFF);
+        step[i] = (len > 1) ? ((b - a) * 65536) / (len - 1) : 0;
+        acc[i] = a * 65536 + 0x8000 + step[i] * start;
+    }
+}
+
+/**
+  * @brief	沿水平方向生成一行渐变
+  *	@param	dst: 第一个像素
+  *	@param	n: 像素个数
+  *	@param	x: 第一个像素的屏幕 X（用于抖动）
+  *	@param	bayer: 本行的抖动阈值（不抖动时为NULL）
+*/
+static void grad_row(akiegui_pixel_t *dst, uint32_t n, int32_t x, const int32_t acc[3],
+                     const int32_t step[3], const uint8_t *bayer, uint8_t opa) {
+    int32_t r = acc[0], g = acc[1], b = acc[2];
+    for (uint32_t i = 0; i < n; i++, x++) {
+        akiegui_color_t c = grad_pack((uint32_t)r >> 16, (uint32_t)g >> 16, (uint32_t)b >> 16,
+                                      bayer ? bayer[x & 3] : 0);
+        dst[i] = (opa == AKIEGUI_OPA_COVER) ? c : akiegui_blend(dst[i], c, opa);
+        r += step[0];
+        g += step[1];
+        b += step[2];
+    }
+}
+
+/**
+  * @brief	线性渐变填充矩形
+  *	@param	fb: 绘制缓冲区
+  *	@param	x: 矩形坐标 X
+  *	@param	y: 矩形坐标 Y
+  *	@param	w: 矩形宽度
+  *	@param	h: 矩形高度
+  *	@param	c0: 起点颜色（RGB888）
+  *	@param	c1: 终点颜色（RGB888）
+  *	@param	dir: 方向 AKIEGUI_GRAD_HOR / AKIEGUI_GRAD_VER
+*/
+void akiegui_fill_linear_gradient(
+    void *fb,
+    int16_t x, int16_t y,
+    uint16_t w, uint16_t h,
+    uint32_t c0, uint32_t c1,
+    uint8_t dir
+) {
+    int32_t x0, y0, x1, y1;
+    int clipped = grad_clip(fb, x, y, w, h, &x0, &y0, &x1, &y1);
+    if (clipped == 1) akiegui_dl_gradient(0, x, y, w, h, 0, 0, 0, c0, c1, dir);
+    if (clipped != 0) return;
+
+    uint32_t fb_width = g_akiegui.fb_width;
+    uint32_t cw = (uint32_t)(x1 - x0);
+    uint8_t opa = g_akiegui.draw_opa;
+    akiegui_pixel_t *row = (akiegui_pixel_t*)fb + (uint32_t)y0 * fb_width + x0;
+    int32_t acc[3], step[3];
+
+    if (dir == AKIEGUI_GRAD_HOR) {
+        grad_setup(c0, c1, w, x0 - x, acc, step);
+
+        /* 不透明时每行都一样（抖动时以4行为周期），生成一个周期后按行复制 */
+        int32_t period = (opa == AKIEGUI_OPA_COVER) ? (GRAD_DITHER ? 4 : 1) : (y1 - y0);
+        for (int32_t yy = y0; yy < y1; yy++, row += fb_width) {
+            if (yy - y0 >= period) {
+                memcpy(row, row - (uint32_t)period * fb_width, cw * sizeof(akiegui_pixel_t));
+                continue;
+            }
+#if GRAD_DITHER
+            grad_row(row, cw, x0, acc, step, s_bayer4[yy & 3], opa);
+#else
+            grad_row(row, cw, x0, acc, step, NULL, opa);
+#endif
+        }
+        return;
+    }
+
+    /* 垂直方向：每行一种颜色 */
+    grad_setup(c0, c1, h, y0 - y, acc, step);
+    for (int32_t yy = y0; yy < y1; yy++, row += fb_width) {
+        uint32_t r = (uint32_t)acc[0] >> 16, g = (uint32_t)acc[1] >> 16, b = (uint32_t)acc[2] >> 16;
+        acc[0] += step[0];
+        acc[1] += step[1];
+        acc[2] += step[2];
+
+#if GRAD_DITHER
+        /* 抖动后一行是以4像素为周期的花纹，四个都一样时退化成单色 */
+        const uint8_t *bayer = s_bayer4[yy & 3];
+        akiegui_color_t pat[4];
+        for (int i = 0; i < 4; i++) pat[i] = grad_pack(r, g, b, bayer[(x0 + i) & 3]);
+        if (pat[0] != pat[1] || pat[0] != pat[2] || pat[0] != pat[3]) {
+            for (uint32_t i = 0; i < cw; i++) {
+                row[i] = (opa == AKIEGUI_OPA_COVER) ? pat[i & 3] : akiegui_blend(row[i], pat[i & 3], opa);
+            }
+            continue;
+        }
+        akiegui_color_t c = pat[0];
+#else
+        akiegui_color_t c = grad_pack(r, g, b, 0);
+#endif
+        if (opa == AKIEGUI_OPA_COVER) {
+            akiegui_fill_span(row, cw, c);
+        } else {
+            akiegui_blend_span(row, cw, c, opa);
+        }
+    }
+}
+
+/**
+  * @brief	取 c0→c1 的256级颜色表（端点不变时复用上次的）
+*/
+static const uint32_t* radial_lut(uint32_t c0, uint32_t c1) {
+    c0 &= 0x00FFFFFFu;
+    c1 &= 0x00FFFFFFu;
+    if (s_radial_valid && s_radial_c0 == c0 && s_radial_c1 == c1) return s_radial_lut;
+
+    int32_t acc[3], step[3];
+    grad_setup(c0, c1, 256, 0, acc, step);
+    for (int i = 0; i < 256; i++) {
+        s_radial_lut[i] = (((uint32_t)acc[0] >> 16) << 16) | (((uint32_t)acc[1] >> 16) << 8) |
+                          ((uint32_t)acc[2] >> 16);
+        acc[0] += step[0];
+        acc[1] += step[1];
+        acc[2] += step[2];
+    }
+    s_radial_c0 = c0;
+    s_radial_c1 = c1;
+    s_radial_valid = 1;
+    return s_radial_lut;
+}
+
+/**
+  * @brief	径向渐变填充矩形
+  * @note   距离用增量开方：相邻像素的距离最多差1，平方根只需上下微调
+  *	@param	fb: 绘制缓冲区
+  *	@param	x: 矩形坐标 X
+  *	@param	y: 矩形坐标 Y
+  *	@param	w: 矩形宽度
+  *	@param	h: 矩形高度
+  *	@param	cx: 圆心 X
+  *	@param	cy: 圆心 Y
+  *	@param	r: 渐变半径
+  *	@param	c0: 圆心颜色（RGB888）
+  *	@param	c1: 半径处及以外的颜色（RGB888）
+*/
+void akiegui_fill_radial_gradient(
+    void *fb,
+    int16_t x, int16_t y,
+    uint16_t w, uint16_t h,
+    int16_t cx, int16_t cy,
+    uint16_t r,
+    uint32_t c0, uint32_t c1
+) {
+    int32_t x0, y0, x1, y1;
+    int clipped = grad_clip(fb, x, y, w, h, &x0, &y0, &x1, &y1);
+    if (clipped == 1) akiegui_dl_gradient(1, x, y, w, h, cx, cy, r, c0, c1, 0);
+    if (clipped != 0) return;
+    if (r == 0) r = 1;
+
+    const uint32_t *lut = radial_lut(c0, c1);
+    uint32_t fb_width = g_akiegui.fb_width;
+    uint8_t opa = g_akiegui.draw_opa;
+    akiegui_pixel_t *row = (akiegui_pixel_t*)fb + (uint32_t)y0 * fb_width + x0;
+
+    /* 距离 s 映射到颜色表下标：idx = s * inv >> 16，随 s 增减累加，不做乘法 */
+    uint32_t inv = (255u << 16) / r;
+
+    /* s = floor(sqrt(d2))，sq = s²，nx = (s+1)²；
+     * 第一个像素从0逼近，之后每行开头、每个像素都只差一点 */
+    uint32_t s = 0, sq = 0, nx = 1, acc = 0;
+    int32_t dx0 = x0 - cx;
+
+    for (int32_t yy = y0; yy < y1; yy++, row += fb_width) {
+        int32_t dy = yy - cy;
+        int32_t dx = dx0;
+        uint32_t d2 = (uint32_t)(dx * dx) + (uint32_t)(dy * dy);
+        uint32_t rs = s, rsq = sq, rnx = nx, racc = acc;
+
+#if GRAD_DITHER
+        const uint8_t *bayer = s_bayer4[yy & 3];
+#endif
+        for (int32_t xx = x0; xx < x1; xx++) {
+            while (rnx <= d2) { rsq = rnx; rs++; rnx += 2 * rs + 1; racc += inv; }
+            while (rsq > d2) { rnx = rsq; rs--; rsq -= 2 * rs + 1; racc -= inv; }
+
+            /* 模 2^32 累加：s < r 时 racc 就是精确的 s * inv */
+            uint32_t rgb = lut[(rs < r) ? (racc >> 16) : 255];
+            akiegui_color_t c;
+#if GRAD_DITHER
+            c = grad_pack(rgb >> 16, (rgb >> 8) & 0xFF, rgb & 0xFF, bayer[xx & 3]);
+#else
+            c = akiegui_argb888_to_native(0xFF000000u | rgb);
+#endif
+            akiegui_pixel_t *d = row + (xx - x0);
+            *d = (opa == AKIEGUI_OPA_COVER) ? c : akiegui_blend(*d, c, opa);
+
+            if (xx == x0) {
+                /* 记住行首的状态，下一行从这里出发 */
+                s = rs; sq = rsq; nx = rnx; acc = racc;
+            }
+            d2 += (uint32_t)(2 * dx + 1);
+            dx++;
+        }
+    }
+}
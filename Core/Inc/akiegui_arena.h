@@ -0,0 +1,37 @@
+/* ============= akiegui_arena.h ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 帧临时内存
+ *
+ * 绘制过程中的临时数据（格式化的文字、排版结果等）从这里分配：
+ *   - 只移动指针，不用释放，每帧开始重画时整体清空
+ *   - Mark/Release 可以提前归还一段（如一个控件画完）
+ *   - 记录历史最高用量（包括分配失败时需要的量），用来调整 AkieGUI_ARENA_SIZE
+ * 分配到的内存只在本帧内有效，只能在绘制线程中使用
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#ifndef __AKIEGUI_ARENA_H__
+#define __AKIEGUI_ARENA_H__
+
+#include "akiegui_config.h"
+#include <stdint.h>
+
+/* 分配 size 字节（按8字节对齐），放不下返回NULL */
+void* AkieGUI_Arena_Alloc(uint32_t size);
+
+/* 当前位置；Release 把之后分配的全部归还 */
+uint32_t AkieGUI_Arena_Mark(void);
+void AkieGUI_Arena_Release(uint32_t mark);
+
+/* 清空（重画开始时由控件管理器调用）*/
+void AkieGUI_Arena_Reset(void);
+
+/* 历史最高用量（字节），超过 AkieGUI_ARENA_SIZE 说明有分配失败过 */
+uint32_t AkieGUI_Arena_HighWater(void);
+
+#endif
@@ -21,11 +21,71 @@
 #include "akiegui_config.h"
 #include "akiegui_memory.h"
 
+/* 裁剪栈深度 */
+#ifndef AkieGUI_CLIP_STACK_DEPTH
+#define AkieGUI_CLIP_STACK_DEPTH  8
+#endif
+
+/* 屏幕传输队列深度（TE模式下排队等待发送的区域数，含正在发送的一个）*/
+#ifndef AkieGUI_XFER_QUEUE
+#define AkieGUI_XFER_QUEUE        4
+#endif
+
+/* 双缓冲时每块缓冲区记录的过期区域个数（超过时合并成一个包围盒）*/
+#ifndef AkieGUI_DB_DAMAGE_MAX
+#define AkieGUI_DB_DAMAGE_MAX     8
+#endif
+
+/* ============= 矩形区域 ============= */
+typedef struct {
+    uint16_t x, y;
+    uint16_t w, h;
+} AkieGUI_Rect_T;
+
+/* ============= 屏幕传输 ============= */
+/* 一次排队的传输：data 为第一个像素，行跨度为帧缓冲一行 */
+typedef struct {
+    uint8_t *data;
+    uint32_t len;           /* 整帧时的字节数 */
+    uint16_t x, y, w, h;    /* 屏幕区域（整帧时为整屏）*/
+    uint8_t frame;          /* 1=send_frame 0=send_region */
+} AkieGUI_Xfer_T;
+
+/* ============= 2D加速器接口 ============= */
+/* 一次加速器操作的参数，像素格式为 AKIEGUI_FMT_xxx（见 akiegui_blit.h）*/
+typedef struct {
+    void *dst;              /* 目标第一个像素 */
+    const void *src;        /* 源第一个像素（填充时为NULL）*/
+    uint32_t dst_stride;    /* 目标每行字节数 */
+    uint32_t src_stride;    /* 源每行字节数 */
+    uint16_t w, h;          /* 操作区域大小 */
+    uint8_t dst_format;     /* 目标格式 */
+    uint8_t src_format;     /* 源格式 */
+    uint8_t opa;            /* 整体透明度 0~255 */
+    uint32_t color;         /* 填充颜色（目标格式）*/
+} AkieGUI_GPU_Job_T;
+
+/* 加速器操作表（用户实现，不支持的项填NULL）
+ * 各操作返回0表示已接受：异步执行，完成后在中断里调用 AkieGUI_GPU_Complete()；
+ * 返回非0表示这次做不了，由软件完成 */
+typedef struct {
+    int (*fill)(const AkieGUI_GPU_Job_T *job);      /* 单色填充，opa<255时半透明填充 */
+    int (*copy)(const AkieGUI_GPU_Job_T *job);      /* 同格式复制 */
+    int (*blend)(const AkieGUI_GPU_Job_T *job);     /* 按源像素 alpha（再乘 opa）混合 */
+    int (*convert)(const AkieGUI_GPU_Job_T *job);   /* 格式转换复制 */
+    void (*wait)(void);                             /* CPU等待加速器时调用，可为NULL（忙等）*/
+} AkieGUI_GPU_Ops_T;
+
+/* 显示列表（定义见 akiegui_dlist.h）*/
+typedef struct AkieGUI_DList_S AkieGUI_DList_T;
+
 /* ============= 图形库主结构 ============= */
 typedef struct {
     /* ----- TE同步（唯一硬件依赖）----- */
     #if AkieGUI_TE_MODE == AkieGUI_KE_TE_EN
-    volatile uint8_t te_pending;    /* 传输等待标志 */
+    AkieGUI_Xfer_T xfer[AkieGUI_XFER_QUEUE];   /* 传输队列，队头正在发送 */
+    volatile uint8_t xfer_head;     /* 正在发送的一项 */
+    volatile uint8_t xfer_count;    /* 排队中的个数（含正在发送的）*/
     #endif
     
     /* ----- 屏幕驱动接口（用户实现）----- */
@@ -40,14 +100,44 @@ typedef struct {
     uint32_t fb_width;     /* 帧缓冲宽度 */
     uint32_t fb_height;    /* 帧缓冲高度 */
     uint32_t fb_bpp;       /* 每像素位数 */
-    uint32_t fb_size;      /* 单缓冲区大小 */
+    uint32_t fb_size;      /* 单缓冲区大小（分段渲染时为一块条带的大小）*/
     uint8_t  double_buffer;/* 是否启用双缓冲 */
     
+#if AkieGUI_DOUBLE_BUFFER_MODE
+    /* ----- 双缓冲同步：[0]=fb1 [1]=fb2 比另一块旧的区域 ----- */
+    AkieGUI_Rect_T db_stale[2][AkieGUI_DB_DAMAGE_MAX];
+    uint8_t  db_stale_count[2];
+#endif
+    
+    /* ----- 帧调度 ----- */
+    volatile uint32_t tick_ms;  /* AkieGUI_Tick 累加的毫秒数 */
+    uint32_t frame_due;         /* 下一帧最早可以开始的时刻 */
+    
+    /* ----- 分段渲染：当前条带（整屏缓冲时为整屏）----- */
+    uint16_t band_y;       /* 条带起始行 */
+    uint16_t band_h;       /* 条带行数 */
+    uint8_t  band_index;   /* 正在使用的条带缓冲 0=fb1 1=fb2 */
+    
     /* ----- 屏幕信息 ----- */
     uint16_t screen_width;
     uint16_t screen_height;
     uint8_t  screen_bpp;
     
+    /* ----- 绘制上下文：裁剪栈（栈顶已与屏幕及下层求交）----- */
+    AkieGUI_Rect_T clip_stack[AkieGUI_CLIP_STACK_DEPTH];
+    uint8_t  clip_depth;   /* 0=不裁剪（整个帧缓冲）*/
+    uint8_t  draw_opa;     /* 绘制透明度 0~255，255=不透明 */
+    
+    /* ----- 2D加速器（栅栏：已提交数 == 已完成数 时空闲）----- */
+    const AkieGUI_GPU_Ops_T *gpu;       /* NULL=全部软件绘制 */
+    volatile uint32_t gpu_submitted;    /* 已提交的操作数 */
+    volatile uint32_t gpu_completed;    /* 已完成的操作数 */
+    const void *gpu_base;               /* 未完成操作的目标缓冲区 */
+    AkieGUI_Rect_T gpu_dirty;           /* 未完成操作在目标上的包围盒 */
+    
+    /* ----- 显示列表 ----- */
+    AkieGUI_DList_T *dl;                /* 正在录制的显示列表，NULL=直接绘制 */
+    
     /* ----- 用户自定义 ----- */
     void *user_data;
 } AkieGUI_t;
@@ -55,50 +145,96 @@ typedef struct {
 /* 全局实例 */
 extern AkieGUI_t g_akiegui;
 
+/* ============= 2D加速器栅栏 ============= */
+
+/**
+ * @brief 加速器每完成一个操作，在完成中断里调用一次
+ */
+static inline void AkieGUI_GPU_Complete(void) {
+    g_akiegui.gpu_completed++;
+}
+
+/**
+ * @brief 等待已提交的加速器操作全部完成
+ */
+static inline void AkieGUI_GPU_Sync(void) {
+    while (g_akiegui.gpu_completed != g_akiegui.gpu_submitted) {
+        if (g_akiegui.gpu && g_akiegui.gpu->wait) {
+            g_akiegui.gpu->wait();
+        }
+    }
+}
+
 /* ============= TE同步API（编译期优化）============= */
 
+#if AkieGUI_TE_MODE == AkieGUI_KE_TE_EN
 /**
  * @brief 用户必须在传输完成中断中调用此函数！
  *        无论DMA2D、BDMA、SPI、TIMER、GPIO中断，只要传输完成就调它
+ * @note  TE模式下传输排队进行：这里出队刚发完的一项，并在中断里直接开始发送下一项
  */
-static inline void AkieGUI_TransmitEnd(void) {
-#if AkieGUI_TE_MODE == AkieGUI_KE_TE_EN
-    g_akiegui.te_pending = 0;
+void AkieGUI_TransmitEnd(void);
+
+/* 传输入队，队列空闲时立即开始发送；队列满时等待 */
+void AkieGUI_Xfer_Push(const AkieGUI_Xfer_T *t);
+
+/* 等到与 fb 上 (x, y, w, h) 重叠的排队传输全部发完 */
+void AkieGUI_Xfer_Wait(const void *fb, int32_t x, int32_t y, int32_t w, int32_t h);
 #else
+static inline void AkieGUI_TransmitEnd(void) {
     /* 无TE模式：空操作，编译优化掉 */
-#endif
 }
+#endif
 
 /**
  * @brief 用户发送帧时调用此函数
+ * @note  TE模式下只是排队，返回时可能还没发完
  */
 static inline void AkieGUI_SendFrame(uint8_t *data, uint32_t len) {
 #if AkieGUI_TE_MODE == AkieGUI_KE_TE_EN
-    g_akiegui.te_pending = 1;  /* 置位等待标志 */
-#endif
+    AkieGUI_Xfer_T t = { data, len, 0, 0,
+                         (uint16_t)g_akiegui.fb_width, (uint16_t)g_akiegui.fb_height, 1 };
+    AkieGUI_Xfer_Push(&t);
+#else
     if (g_akiegui.send_frame) {
         g_akiegui.send_frame(data, len);
     }
+#endif
 }
 
 /**
  * @brief 用户发送区域时调用此函数
+ * @note  TE模式下只是排队，返回时可能还没发完
  */
 static inline void AkieGUI_SendRegion(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t *data) {
 #if AkieGUI_TE_MODE == AkieGUI_KE_TE_EN
-    g_akiegui.te_pending = 1;
-#endif
+    AkieGUI_Xfer_T t = { data, 0, x, y, w, h, 0 };
+    AkieGUI_Xfer_Push(&t);
+#else
     if (g_akiegui.send_region) {
         g_akiegui.send_region(x, y, w, h, data);
     }
+#endif
 }
 
 /**
- * @brief 等待上一帧传输完成
+ * @brief 等待排队的传输全部完成
  */
 static inline void AkieGUI_WaitTE(void) {
 #if AkieGUI_TE_MODE == AkieGUI_KE_TE_EN
-    while (g_akiegui.te_pending);
+    while (g_akiegui.xfer_count);
+#endif
+}
+
+/**
+ * @brief 写帧缓冲 fb 上的 (x, y, w, h) 之前调用：与还没发完的传输重叠时等待
+ */
+static inline void AkieGUI_Xfer_WaitRect(const void *fb, int32_t x, int32_t y, int32_t w, int32_t h) {
+#if AkieGUI_TE_MODE == AkieGUI_KE_TE_EN
+    if (g_akiegui.xfer_count == 0 || w <= 0 || h <= 0) return;
+    AkieGUI_Xfer_Wait(fb, x, y, w, h);
+#else
+    (void)fb; (void)x; (void)y; (void)w; (void)h;
 #endif
 }
 
@@ -110,10 +246,29 @@ static inline void AkieGUI_WaitTE(void) {
  */
 int AkieGUI_FBInit(void);
 
+#if AkieGUI_DOUBLE_BUFFER_MODE
+/* 把前台缓冲中比绘制缓冲新的区域复制到绘制缓冲 */
+void AkieGUI_DB_Sync(void);
+
+/* 绘制缓冲的 (x, y, w, h) 已提交，记为另一块缓冲的过期区域 */
+void AkieGUI_DB_Damage(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/**
+ * @brief 绘制缓冲是否有过期区域
+ */
+static inline uint8_t AkieGUI_DB_Stale(void) {
+    return g_akiegui.db_stale_count[g_akiegui.draw_fb == (void*)g_akiegui.fb2];
+}
+#endif
+
 /**
  * @brief 获取当前绘制缓冲区
+ * @note  双缓冲时先把上一帧改过的区域补到这块缓冲里，之后只需局部重画
  */
 static inline void* AkieGUI_GetDrawFB(void) {
+#if AkieGUI_DOUBLE_BUFFER_MODE
+    if (AkieGUI_DB_Stale()) AkieGUI_DB_Sync();
+#endif
     return g_akiegui.draw_fb;
 }
 
@@ -126,8 +281,10 @@ static inline void* AkieGUI_GetDispFB(void) {
 
 /**
  * @brief 交换缓冲区（双缓冲模式）
+ * @note  只交换指针；新绘制缓冲里过期的区域在下次取绘制缓冲或提交时才复制
  */
 static inline void AkieGUI_SwapBuffer(void) {
+    AkieGUI_GPU_Sync();
     if (g_akiegui.double_buffer) {
         void *tmp = g_akiegui.draw_fb;
         g_akiegui.draw_fb = g_akiegui.disp_fb;
@@ -135,16 +292,35 @@ static inline void AkieGUI_SwapBuffer(void) {
     }
 }
 
+#if AkieGUI_TILE_SIZE
+/* 分块提交：屏幕内容被直接提交改变后作废块校验和（见 akiegui_tile.h）*/
+void AkieGUI_Tile_Forget(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+#endif
+
 /**
- * @brief 提交整帧到屏幕
+ * @brief 提交整帧到屏幕（分段渲染时提交当前条带）
  */
 static inline int AkieGUI_Commit(void) {
+#if AkieGUI_DOUBLE_BUFFER_MODE
+    AkieGUI_DB_Damage(0, 0, g_akiegui.fb_width, g_akiegui.fb_height);
+#endif
+    AkieGUI_GPU_Sync();
+#if AkieGUI_BAND_LINES
+    uint32_t offset = (uint32_t)g_akiegui.band_y * g_akiegui.fb_width * (g_akiegui.fb_bpp / 8);
+    AkieGUI_SendRegion(0, g_akiegui.band_y, g_akiegui.fb_width, g_akiegui.band_h,
+                       (uint8_t*)g_akiegui.draw_fb + offset);
+#else
     AkieGUI_SendFrame(g_akiegui.draw_fb, g_akiegui.fb_size);
+#endif
+#if AkieGUI_TILE_SIZE
+    AkieGUI_Tile_Forget(0, 0, g_akiegui.fb_width, g_akiegui.fb_height);
+#endif
     return 0;
 }
 
 /**
  * @brief 提交区域到屏幕
+ * @note  TE模式下不等发送完成，之后写到这块区域的绘制才会等待
  */
 static inline int AkieGUI_CommitRegion(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
     if (x >= g_akiegui.fb_width || y >= g_akiegui.fb_height) return -1;
@@ -155,16 +331,88 @@ static inline int AkieGUI_CommitRegion(uint16_t x, uint16_t y, uint16_t w, uint1
     uint32_t bytes_per_pixel = g_akiegui.fb_bpp / 8;
     uint32_t offset = (y * g_akiegui.fb_width + x) * bytes_per_pixel;
 
+#if AkieGUI_DOUBLE_BUFFER_MODE
+    AkieGUI_DB_Damage(x, y, w, h);
+#endif
+    AkieGUI_GPU_Sync();
     // 一次发送整个矩形区域
-    AkieGUI_SendRegion(x, y, w, h, g_akiegui.draw_fb + offset);
-    AkieGUI_WaitTE();
+    AkieGUI_SendRegion(x, y, w, h, (uint8_t*)g_akiegui.draw_fb + offset);
+#if AkieGUI_TILE_SIZE
+    AkieGUI_Tile_Forget(x, y, w, h);
+#endif
 
     return 0;
 }
 
+/* ============= 分段渲染API ============= */
+
 /**
- * @brief 触摸处理函数
+ * @brief 开始绘制从第 y 行起、最多 h 行的条带
+ * @note  分段渲染时换到另一块条带缓冲，并把绘制缓冲区指针按起始行往前偏移，
+ *        绘制函数照常使用屏幕坐标，裁剪区自动限制在条带内；
+ *        整屏缓冲时只记录范围，返回 h
+ * @retval 本条带的行数
+ */
+static inline uint16_t AkieGUI_BandBegin(uint16_t y, uint16_t h) {
+    if (y >= g_akiegui.fb_height) return 0;
+    if (y + h > g_akiegui.fb_height) h = g_akiegui.fb_height - y;
+#if AkieGUI_BAND_LINES
+    if (h > AkieGUI_BAND_LINES) h = AkieGUI_BAND_LINES;
+    g_akiegui.band_index ^= 1;
+    uint8_t *buf = g_akiegui.band_index ? g_akiegui.fb2 : g_akiegui.fb1;
+    g_akiegui.draw_fb = buf - (uint32_t)y * g_akiegui.fb_width * (g_akiegui.fb_bpp / 8);
+#endif
+    g_akiegui.band_y = y;
+    g_akiegui.band_h = h;
+    return h;
+}
+
+/**
+ * @brief 发送当前条带中 [x, x+w) 列
+ * @note  分段渲染时只排队不等待，绘制下一块条带与本条带的传输同时进行，
+ *        画到还没发完的条带缓冲时才等待；
+ *        无TE模式下 send_region 需在返回前用完数据；
+ *        整屏缓冲时等同 AkieGUI_CommitRegion
+ */
+static inline void AkieGUI_BandCommit(uint16_t x, uint16_t w) {
+#if AkieGUI_BAND_LINES
+    if (x >= g_akiegui.fb_width || w == 0 || g_akiegui.band_h == 0) return;
+    if (x + w > g_akiegui.fb_width) w = g_akiegui.fb_width - x;
+
+    uint32_t offset = ((uint32_t)g_akiegui.band_y * g_akiegui.fb_width + x) * (g_akiegui.fb_bpp / 8);
+    AkieGUI_GPU_Sync();
+    AkieGUI_SendRegion(x, g_akiegui.band_y, w, g_akiegui.band_h, (uint8_t*)g_akiegui.draw_fb + offset);
+#else
+    AkieGUI_CommitRegion(x, g_akiegui.band_y, w, g_akiegui.band_h);
+#endif
+}
+
+/**
+ * @brief 触摸处理函数（只改状态、标记脏区域，重绘交给 AkieGUI_Task）
  */
 void AkieGUI_ProcessTouch(void);
 
+/**
+ * @brief 忘掉按住的控件（控件被删除时由 AkieGUI_Widget_Delete 调用，抬起时不再访问它）
+ * @param widget: 被删除的控件
+ */
+struct AkieGUI_Widget;
+void AkieGUI_Touch_Forget(const struct AkieGUI_Widget *widget);
+
+/**
+ * @brief 推进时基，在定时中断里调用（如 SysTick 每1ms调用 AkieGUI_Tick(1)）
+ * @param ms: 距上次调用经过的毫秒数
+ */
+static inline void AkieGUI_Tick(uint32_t ms) {
+    g_akiegui.tick_ms += ms;
+}
+
+/**
+ * @brief 帧调度，在主循环里反复调用
+ * @note  处理触摸；一帧周期内的所有脏区域攒到一起，按 AkieGUI_TARGET_FPS 最多重绘一次，
+ *        没有变化时整帧跳过
+ * @retval 1=这次重绘并提交了一帧，0=没有
+ */
+uint8_t AkieGUI_Task(void);
+
 #endif
\ No newline at end of file
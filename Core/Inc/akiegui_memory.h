@@ -9,6 +9,7 @@
  *   - 内存块结构
  *   - 内存池管理器
  *   - 分配/释放函数声明
+ *   - 运行统计：峰值、最大空闲块、碎片率、按用途标签分类的用量
  *
  * 许可证: AGPL v3 (看许可证文件)
  * 联系方式: xuelin-sherlyn@outlook.com
@@ -24,14 +25,15 @@
 #ifndef AkieGUI_ALIGN
 #define AkieGUI_ALIGN 16
 #endif
-#define AkieGUI_ALIGN_UP(x, align) (((x) + (align) - 1) & ~((align) - 1))
+#define AkieGUI_ALIGN_UP(x, align) (((x) + (align) - 1) & ~((uintptr_t)(align) - 1))
 
-/* 内存块头 */
+/* 内存块头（块在池中首尾相接，空闲块按地址顺序串成链表）*/
 typedef struct AkieGUI_Mem_Block {
     struct AkieGUI_Mem_Block *next;
     uint32_t size;
     uint32_t magic;
     uint8_t used;
+    uint8_t tag;            /* 用途标签（AkieGUI_MemTag_T）*/
 } AkieGUI_Mem_Block_T;
 
 /* 内存管理器 */
@@ -43,13 +45,49 @@ typedef struct {
     AkieGUI_Mem_Block_T *free_list;
 } AkieGUI_Mem_T;
 
+/* 内存用途标签（不带标签的分配记在 OTHER 下）*/
+typedef enum {
+    AkieGUI_MEM_TAG_OTHER = 0,
+    AkieGUI_MEM_TAG_FB,         /* 显存 */
+    AkieGUI_MEM_TAG_BG,         /* 背景层 */
+    AkieGUI_MEM_TAG_IMAGE,      /* 图片缓存（给应用缓存解码后的图片用，库里不用）*/
+    AkieGUI_MEM_TAG_FONT,       /* 字库索引 */
+    AkieGUI_MEM_TAG_WIDGET,     /* 控件对象池 */
+    AkieGUI_MEM_TAG_COUNT
+} AkieGUI_MemTag_T;
+
+/* 单个标签的用量（字节数连同块头，与 AkieGUI_MemGetUsed 口径一致）*/
+typedef struct {
+    uint32_t count;         /* 当前块数 */
+    uint32_t bytes;         /* 当前字节数 */
+    uint32_t peak;          /* 历史最高字节数 */
+} AkieGUI_MemTagStat_T;
+
+/* 内存统计 */
+typedef struct {
+    uint32_t total;         /* 内存池大小 */
+    uint32_t used;          /* 当前占用 */
+    uint32_t peak;          /* 历史最高占用 */
+    uint32_t largest_free;  /* 最大空闲块的可用字节数 */
+    uint32_t free_blocks;   /* 空闲块个数 */
+    uint32_t fail_count;    /* 分配失败次数 */
+    uint8_t frag;           /* 碎片率%：100 - 最大空闲块/空闲总量 */
+    AkieGUI_MemTagStat_T tag[AkieGUI_MEM_TAG_COUNT];
+} AkieGUI_MemStat_T;
+
 /* 统一内存管理API */
 int AkieGUI_MemInit(void *start, uint32_t size);
 void* AkieGUI_MemAlloc(uint32_t size);
 void* AkieGUI_MemAllocAlign(uint32_t size, uint32_t align);
+void* AkieGUI_MemAllocTag(uint32_t size, uint8_t tag);
+void* AkieGUI_MemAllocAlignTag(uint32_t size, uint32_t align, uint8_t tag);
 void* AkieGUI_MemCalloc(uint32_t nmemb, uint32_t size);
 void AkieGUI_MemFree(void *ptr);
 uint32_t AkieGUI_MemGetFree(void);
 uint32_t AkieGUI_MemGetUsed(void);
 
+/* 内存统计：GetStat 要遍历空闲块，用于调试/日志，不要放在绘制路径上 */
+void AkieGUI_MemGetStat(AkieGUI_MemStat_T *stat);
+void AkieGUI_MemResetPeak(void);
+
 #endif
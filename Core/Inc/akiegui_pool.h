@@ -0,0 +1,52 @@
+/* ============= akiegui_pool.h ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 定长对象池
+ *
+ * 同一种对象（如一种控件）从自己的池里分配：
+ *   - 池不够时用 AkieGUI_MemAlloc 一次扩充 chunk 个对象，用多少扩多少
+ *   - 空闲对象串成链表，分配、释放都是 O(1)
+ *   - 每块记着里面有几个对象在用，一块空了就还给内存池（留一块空块备用，免得反复扩充）；
+ *     池里的对象全部释放后，备用块也还回去
+ *
+ * 用法：
+ *   static AkieGUI_Pool_T s_pool = AKIEGUI_POOL_INIT(My_T, 8);
+ *   My_T *p = AkieGUI_Pool_Alloc(&s_pool);
+ *   AkieGUI_Pool_Free(&s_pool, p);
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#ifndef __AKIEGUI_POOL_H__
+#define __AKIEGUI_POOL_H__
+
+#include "akiegui_memory.h"
+#include <stdint.h>
+
+/* 对象和块头的对齐（够放指针和64位数据）*/
+#define AKIEGUI_POOL_ALIGN      8
+
+typedef struct {
+    uint32_t obj_size;      /* 对象大小（已对齐）*/
+    uint16_t chunk;         /* 每次扩充的对象个数 */
+    uint16_t used;          /* 使用中的对象数 */
+    uint16_t capacity;      /* 已扩充的对象总数 */
+    void *free_list;        /* 空闲对象链表（对象开头存下一个）*/
+    void *chunks;           /* 扩充的内存块链表（块头里存下一块）*/
+    void *spare;            /* 空着备用的块，没有为NULL */
+} AkieGUI_Pool_T;
+
+/* 静态初始化：type=对象类型，chunk=每次扩充的个数 */
+#define AKIEGUI_POOL_INIT(type, chunk_objs) \
+    { (uint32_t)AkieGUI_ALIGN_UP(sizeof(type), AKIEGUI_POOL_ALIGN), (chunk_objs), 0, 0, NULL, NULL, NULL }
+
+/* 分配一个对象（内容未清零），内存不足返回NULL */
+void* AkieGUI_Pool_Alloc(AkieGUI_Pool_T *pool);
+
+/* 释放一个对象；所在的块空了就还给内存池 */
+void AkieGUI_Pool_Free(AkieGUI_Pool_T *pool, void *obj);
+
+#endif
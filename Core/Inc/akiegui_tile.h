@@ -0,0 +1,40 @@
+/* ============= akiegui_tile.h ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 分块提交部分（AkieGUI_TILE_SIZE > 0 时启用）
+ *
+ * 帧缓冲分成固定大小的块：
+ *   - 重画区域所在的块置脏
+ *   - 提交前对脏块算校验和，与上次发送时相同的块跳过（同样的文字、没变的进度条）
+ *   - 剩下的块合并成尽量大的矩形，用 send_region 发送
+ *
+ * 不经过本模块的提交（AkieGUI_Commit / AkieGUI_CommitRegion）会让对应块的校验和作废
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#ifndef __AKIEGUI_TILE_H__
+#define __AKIEGUI_TILE_H__
+
+#include "akiegui_core.h"
+
+#if AkieGUI_TILE_SIZE
+
+#define AkieGUI_TILE_COLS   ((AkieGUI_LCD_WIDTH + AkieGUI_TILE_SIZE - 1) / AkieGUI_TILE_SIZE)
+#define AkieGUI_TILE_ROWS   ((AkieGUI_LCD_HEIGHT + AkieGUI_TILE_SIZE - 1) / AkieGUI_TILE_SIZE)
+
+/* 把区域覆盖的块置脏 */
+void AkieGUI_Tile_Invalidate(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/* 作废区域覆盖的块的校验和（屏幕内容已被其他途径改变）*/
+void AkieGUI_Tile_Forget(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+/* 提交脏块中内容变化的部分，返回发送的块数 */
+uint32_t AkieGUI_Tile_Flush(void);
+
+#endif
+
+#endif
@@ -0,0 +1,47 @@
+/* ============= akiegui_tlsf.h ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * TLSF 内存池（AkieGUI_MEM_ALLOCATOR == AkieGUI_MEM_TLSF 时启用）
+ *
+ * 两级分离适配（Two-Level Segregated Fit）：
+ *   - 空闲块按大小分到 一级（2的幂）× 二级（一级内再等分16份）的链表里
+ *   - 两级位图记录哪些链表非空，查找只用几次位运算，不遍历
+ *   - 释放时与物理上前后相邻的空闲块合并（块头记录前一块的地址）
+ * 分配、释放的耗时与内存池状态无关，由 akiegui_memory.c 在临界区内调用
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#ifndef __AKIEGUI_TLSF_H__
+#define __AKIEGUI_TLSF_H__
+
+#include "akiegui_config.h"
+#include <stdint.h>
+
+#if AkieGUI_MEM_ALLOCATOR == AkieGUI_MEM_TLSF
+
+/* 用一块内存初始化，成功返回0 */
+int akiegui_tlsf_init(void *start, uint32_t size);
+
+/* 分配 size 字节，地址按 align（2的幂）对齐，tag 记在块头里 */
+void* akiegui_tlsf_alloc(uint32_t size, uint32_t align, uint8_t tag);
+
+/* 释放，不是本池分配的指针直接忽略 */
+void akiegui_tlsf_free(void *ptr);
+
+/* 内存池总大小、空闲大小（与首次适应一样，已分配块连同块头算作占用）*/
+uint32_t akiegui_tlsf_pool_size(void);
+uint32_t akiegui_tlsf_free_size(void);
+
+/* 占用块连同块头的字节数和标签，不是本池分配的指针返回0 */
+uint32_t akiegui_tlsf_block_size(const void *ptr, uint8_t *tag);
+
+/* 最大空闲块的数据区字节数，count 带回空闲块个数（遍历空闲链表）*/
+uint32_t akiegui_tlsf_largest_free(uint32_t *count);
+
+#endif
+
+#endif
@@ -0,0 +1,45 @@
+/* ============= akiegui_arena.c ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 帧临时内存实现（静态缓冲区 + 移动指针）
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#include "akiegui_arena.h"
+#include <stddef.h>
+
+#define ARENA_ALIGN     8
+
+static uint64_t s_arena_buf[(AkieGUI_ARENA_SIZE + 7) / 8];
+static uint32_t s_arena_used = 0;
+static uint32_t s_arena_peak = 0;
+
+void* AkieGUI_Arena_Alloc(uint32_t size) {
+    uint32_t need = s_arena_used + ((size + ARENA_ALIGN - 1) & ~(uint32_t)(ARENA_ALIGN - 1));
+    if (need > s_arena_peak) s_arena_peak = need;
+    if (size == 0 || need > sizeof(s_arena_buf)) return NULL;
+
+    void *p = (uint8_t*)s_arena_buf + s_arena_used;
+    s_arena_used = need;
+    return p;
+}
+
+uint32_t AkieGUI_Arena_Mark(void) {
+    return s_arena_used;
+}
+
+void AkieGUI_Arena_Release(uint32_t mark) {
+    if (mark < s_arena_used) s_arena_used = mark;
+}
+
+void AkieGUI_Arena_Reset(void) {
+    s_arena_used = 0;
+}
+
+uint32_t AkieGUI_Arena_HighWater(void) {
+    return s_arena_peak;
+}
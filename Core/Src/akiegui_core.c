@@ -9,6 +9,7 @@
  *   - 计算缓冲区大小
  *   - 分配内存（通过memory层）
  *   - 设置双缓冲/单缓冲模式
+ * 以及TE模式下的屏幕传输队列、双缓冲的过期区域同步、帧调度
  * 
  * 其他操作都在头文件中内联实现
  *
@@ -21,13 +22,16 @@
 #include "akiegui_config.h"
 #include "akiegui_memory.h"
 #include "akiegui_touch.h"
+#include "akiegui_blit.h"
+#include "akiegui_blend.h"
 #include "stdint.h"
 #include "stddef.h"
 
 /* 全局实例定义 */
 AkieGUI_t g_akiegui = {
 #if AkieGUI_TE_MODE == AkieGUI_KE_TE_EN
-    .te_pending = 0,
+    .xfer_head = 0,
+    .xfer_count = 0,
 #endif
     .send_frame = NULL,
     .send_region = NULL,
@@ -40,9 +44,21 @@ AkieGUI_t g_akiegui = {
     .fb_bpp = 0,
     .fb_size = 0,
     .double_buffer = 0,
+    .tick_ms = 0,
+    .frame_due = 0,
+    .band_y = 0,
+    .band_h = 0,
+    .band_index = 0,
     .screen_width = 0,
     .screen_height = 0,
     .screen_bpp = 0,
+    .clip_depth = 0,
+    .draw_opa = 255,
+    .gpu = NULL,
+    .gpu_submitted = 0,
+    .gpu_completed = 0,
+    .gpu_base = NULL,
+    .dl = NULL,
     .user_data = NULL
 };
 
@@ -57,16 +73,21 @@ int AkieGUI_FBInit(void) {
     uint32_t bytes_per_pixel = AkieGUI_LCD_BPP / 8;
     if (bytes_per_pixel == 0) bytes_per_pixel = 2;  /* 默认RGB565 */
     
+#if AkieGUI_BAND_LINES
+    /* 分段渲染：两块条带缓冲交替使用 */
+    uint32_t fb_size = AkieGUI_LCD_WIDTH * AkieGUI_BAND_LINES * bytes_per_pixel;
+#else
     uint32_t fb_size = AkieGUI_LCD_WIDTH * AkieGUI_LCD_HEIGHT * bytes_per_pixel;
+#endif
     fb_size = AkieGUI_ALIGN_UP(fb_size, AkieGUI_ALIGN);
     
     /* 分配缓冲区1 */
-    g_akiegui.fb1 = (uint8_t*)AkieGUI_MemAllocAlign(fb_size, 32);
+    g_akiegui.fb1 = (uint8_t*)AkieGUI_MemAllocAlignTag(fb_size, 32, AkieGUI_MEM_TAG_FB);
     if (!g_akiegui.fb1) return -1;
     
     /* 分配缓冲区2（如果需要）*/
-    if (AkieGUI_DOUBLE_BUFFER_MODE) {
-        g_akiegui.fb2 = (uint8_t*)AkieGUI_MemAllocAlign(fb_size, 32);
+    if (AkieGUI_DOUBLE_BUFFER_MODE || AkieGUI_BAND_LINES) {
+        g_akiegui.fb2 = (uint8_t*)AkieGUI_MemAllocAlignTag(fb_size, 32, AkieGUI_MEM_TAG_FB);
         if (!g_akiegui.fb2) {
             AkieGUI_MemFree(g_akiegui.fb1);
             return -2;
@@ -88,10 +109,180 @@ int AkieGUI_FBInit(void) {
     g_akiegui.screen_width = AkieGUI_LCD_WIDTH;
     g_akiegui.screen_height = AkieGUI_LCD_HEIGHT;
     g_akiegui.screen_bpp = AkieGUI_LCD_BPP;
+    g_akiegui.band_y = 0;
+#if AkieGUI_BAND_LINES
+    g_akiegui.band_h = (AkieGUI_BAND_LINES < AkieGUI_LCD_HEIGHT) ? AkieGUI_BAND_LINES : AkieGUI_LCD_HEIGHT;
+#else
+    g_akiegui.band_h = AkieGUI_LCD_HEIGHT;
+#endif
+    g_akiegui.band_index = 0;
     
     return 0;
 }
 
+#if AkieGUI_DOUBLE_BUFFER_MODE
+/**
+ * @brief 把前台缓冲中比绘制缓冲新的区域复制到绘制缓冲
+ * @note  走像素块搬运：有加速器时异步复制，之后的绘制只在写到这些区域时等待
+ */
+void AkieGUI_DB_Sync(void) {
+    uint8_t idx = (g_akiegui.draw_fb == (void*)g_akiegui.fb2);
+    uint8_t n = g_akiegui.db_stale_count[idx];
+    g_akiegui.db_stale_count[idx] = 0;
+    if (!g_akiegui.double_buffer || g_akiegui.draw_fb == g_akiegui.disp_fb) return;
+
+    AkieGUI_Surface_T dst, src;
+    akiegui_surface_init(&dst, g_akiegui.draw_fb, (uint16_t)g_akiegui.fb_width,
+                         (uint16_t)g_akiegui.fb_height, AKIEGUI_FMT_NATIVE);
+    akiegui_surface_init(&src, g_akiegui.disp_fb, (uint16_t)g_akiegui.fb_width,
+                         (uint16_t)g_akiegui.fb_height, AKIEGUI_FMT_NATIVE);
+    for (uint8_t i = 0; i < n; i++) {
+        const AkieGUI_Rect_T *r = &g_akiegui.db_stale[idx][i];
+        akiegui_blit(&dst, (int16_t)r->x, (int16_t)r->y, &src, r, AKIEGUI_BLIT_COPY, AKIEGUI_OPA_COVER, 0);
+    }
+}
+
+/**
+ * @brief 绘制缓冲的一块区域已提交：这块在另一块缓冲里过期了
+ * @note  绘制缓冲自己的过期区域先补齐，保证提交出去的都是最新内容
+ */
+void AkieGUI_DB_Damage(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    if (!g_akiegui.double_buffer || w == 0 || h == 0) return;
+    if (AkieGUI_DB_Stale()) AkieGUI_DB_Sync();
+
+    uint8_t other = (g_akiegui.draw_fb == (void*)g_akiegui.fb2) ? 0 : 1;
+    AkieGUI_Rect_T *list = g_akiegui.db_stale[other];
+    uint8_t *count = &g_akiegui.db_stale_count[other];
+    AkieGUI_Rect_T r = { x, y, w, h };
+
+    for (uint8_t i = 0; i < *count; i++) {
+        if (r.x >= list[i].x && r.y >= list[i].y &&
+            r.x + r.w <= list[i].x + list[i].w && r.y + r.h <= list[i].y + list[i].h) {
+            return;
+        }
+    }
+    if (*count < AkieGUI_DB_DAMAGE_MAX) {
+        list[(*count)++] = r;
+        return;
+    }
+
+    /* 放不下：合并成一个包围盒 */
+    uint16_t x0 = r.x, y0 = r.y, x1 = r.x + r.w, y1 = r.y + r.h;
+    for (uint8_t i = 0; i < *count; i++) {
+        if (list[i].x < x0) x0 = list[i].x;
+        if (list[i].y < y0) y0 = list[i].y;
+        if (list[i].x + list[i].w > x1) x1 = list[i].x + list[i].w;
+        if (list[i].y + list[i].h > y1) y1 = list[i].y + list[i].h;
+    }
+    list[0].x = x0;
+    list[0].y = y0;
+    list[0].w = x1 - x0;
+    list[0].h = y1 - y0;
+    *count = 1;
+}
+#endif
+
+#if AkieGUI_TE_MODE == AkieGUI_KE_TE_EN
+/**
+ * @brief 开始发送一项（没有发送函数时当作立即完成）
+ */
+static void xfer_start(const AkieGUI_Xfer_T *t) {
+    if (t->frame && g_akiegui.send_frame) {
+        g_akiegui.send_frame(t->data, t->len);
+    } else if (!t->frame && g_akiegui.send_region) {
+        g_akiegui.send_region(t->x, t->y, t->w, t->h, t->data);
+    } else {
+        AkieGUI_TransmitEnd();
+    }
+}
+
+/**
+ * @brief 传输完成：出队，还有排队的就接着发
+ */
+void AkieGUI_TransmitEnd(void) {
+    if (g_akiegui.xfer_count == 0) return;
+    g_akiegui.xfer_head = (uint8_t)((g_akiegui.xfer_head + 1) % AkieGUI_XFER_QUEUE);
+    g_akiegui.xfer_count--;
+    if (g_akiegui.xfer_count) {
+        xfer_start(&g_akiegui.xfer[g_akiegui.xfer_head]);
+    }
+}
+
+/**
+ * @brief 传输入队
+ * @note  队列原来是空的才由这里开始发送，否则由完成中断接着发
+ * @param t: 传输内容（复制进队列）
+ */
+void AkieGUI_Xfer_Push(const AkieGUI_Xfer_T *t) {
+    uint32_t primask;
+    uint8_t start;
+
+    for (;;) {
+        AkieGUI_ENTER_CRITICAL(primask);
+        if (g_akiegui.xfer_count < AkieGUI_XFER_QUEUE) break;
+        AkieGUI_EXIT_CRITICAL(primask);
+        while (g_akiegui.xfer_count >= AkieGUI_XFER_QUEUE);   /* 队列满，等一项发完 */
+    }
+    uint8_t tail = (uint8_t)((g_akiegui.xfer_head + g_akiegui.xfer_count) % AkieGUI_XFER_QUEUE);
+    g_akiegui.xfer[tail] = *t;
+    g_akiegui.xfer_count++;
+    start = (g_akiegui.xfer_count == 1);
+    AkieGUI_EXIT_CRITICAL(primask);
+
+    if (start) xfer_start(&g_akiegui.xfer[tail]);
+}
+
+/**
+ * @brief 传输 t 的数据与帧缓冲上一块矩形是否有公共字节
+ * @note  两者行跨度相同：先比地址范围，相交时换算成相对 t 的行列再比
+ * @param p: 矩形第一个像素
+ * @param row_bytes: 矩形每行字节数
+ * @param h: 矩形行数
+ * @param stride: 帧缓冲每行字节数
+ */
+static uint8_t xfer_overlap(const AkieGUI_Xfer_T *t, const uint8_t *p,
+                            uint32_t row_bytes, uint32_t h, uint32_t stride) {
+    uint32_t t_row = (uint32_t)t->w * (g_akiegui.fb_bpp / 8);
+    const uint8_t *a0 = t->data;
+    const uint8_t *a1 = a0 + (uint32_t)(t->h - 1) * stride + t_row;
+    const uint8_t *b1 = p + (h - 1) * stride + row_bytes;
+    if (b1 <= a0 || a1 <= p) return 0;
+
+    /* p 相对 t 第一个像素：dy 行 dx 字节（0 <= dx < stride），矩形每行可能折到下一行 */
+    intptr_t d = p - a0;
+    int32_t dy = (d >= 0) ? (int32_t)(d / (intptr_t)stride)
+                          : -(int32_t)((-d + (intptr_t)stride - 1) / (intptr_t)stride);
+    uint32_t dx = (uint32_t)(d - (intptr_t)dy * (intptr_t)stride);
+    int32_t th = t->h;
+
+    if (dy < th && dy + (int32_t)h > 0 && dx < t_row) return 1;
+    if (dx + row_bytes > stride && dy + 1 < th && dy + 1 + (int32_t)h > 0) return 1;
+    return 0;
+}
+
+/**
+ * @brief 等到与 fb 上 (x, y, w, h) 重叠的排队传输全部发完
+ */
+void AkieGUI_Xfer_Wait(const void *fb, int32_t x, int32_t y, int32_t w, int32_t h) {
+    uint32_t bpp = g_akiegui.fb_bpp / 8;
+    uint32_t stride = g_akiegui.fb_width * bpp;
+    const uint8_t *p = (const uint8_t*)fb + (intptr_t)y * (intptr_t)stride + (intptr_t)x * bpp;
+
+    for (;;) {
+        /* 入队只在绘制线程里进行，中断只出队：遍历期间队列里的项不会被改写 */
+        uint8_t head = g_akiegui.xfer_head;
+        uint8_t count = g_akiegui.xfer_count;
+        uint8_t hit = 0;
+        for (uint8_t i = 0; i < count && !hit; i++) {
+            hit = xfer_overlap(&g_akiegui.xfer[(head + i) % AkieGUI_XFER_QUEUE],
+                               p, (uint32_t)w * bpp, (uint32_t)h, stride);
+        }
+        if (!hit) return;
+        while (g_akiegui.xfer_count == count);   /* 等发完一项再查 */
+    }
+}
+#endif
+
 void AkieGUI_ProcessTouch(void) {
     uint16_t x, y;
     uint8_t pressed;
@@ -105,7 +296,6 @@ void AkieGUI_ProcessTouch(void) {
         if (g_touch_down_widget) {
             g_touch_down_widget->state |= AKIEGUI_STATE_PRESSED;
             AkieGUI_Widget_MarkDirty(g_touch_down_widget);
-            AkieGUI_Widget_RedrawDirtyRegion();   // 或只刷新脏控件
             if(g_touch_down_widget->on_click)
             {
                 g_touch_down_widget->on_click(g_touch_down_widget);
@@ -113,17 +303,39 @@ void AkieGUI_ProcessTouch(void) {
         }
     } else if(!pressed && last_pressed) {
         // 抬起：触发 click（如果按下和抬起是同一个控件）
+        // 按住期间控件被删除时 AkieGUI_Touch_Forget 已清空指针
         if (g_touch_down_widget) {
             if (g_touch_down_widget->on_release) {
                 g_touch_down_widget->on_release(g_touch_down_widget);
             }
             g_touch_down_widget->state &= ~AKIEGUI_STATE_PRESSED;
             AkieGUI_Widget_MarkDirty(g_touch_down_widget);
-            AkieGUI_Widget_RedrawDirtyRegion();
-            g_touch_down_widget = NULL;
         }
+        g_touch_down_widget = NULL;
     }else {
         return;
     }
     last_pressed = pressed;
-}
\ No newline at end of file
+}
+
+void AkieGUI_Touch_Forget(const struct AkieGUI_Widget *widget) {
+    /* 控件内存会被新控件复用，只比较地址不够，必须在删除时就清掉 */
+    if (g_touch_down_widget == widget) g_touch_down_widget = NULL;
+}
+
+uint8_t AkieGUI_Task(void) {
+    AkieGUI_ProcessTouch();
+
+#if AkieGUI_TARGET_FPS
+    uint32_t now = g_akiegui.tick_ms;
+    if ((int32_t)(now - g_akiegui.frame_due) < 0) return 0;   /* 还在这一帧的周期内，继续攒 */
+#endif
+    if (AkieGUI_Widget_CollectDirty() == 0) return 0;         /* 没有变化：跳过这一帧 */
+
+#if AkieGUI_TARGET_FPS
+    /* 从本帧开始算下一帧（空闲后的第一次变化立即重绘）*/
+    g_akiegui.frame_due = now + (1000 + AkieGUI_TARGET_FPS - 1) / AkieGUI_TARGET_FPS;
+#endif
+    AkieGUI_Widget_RedrawDirtyRegion();
+    return 1;
+}
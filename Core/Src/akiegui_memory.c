@@ -6,26 +6,66 @@
  * 内存管理器实现
  * 
  * 实现内存池管理：
- *   - 首次适应算法
- *   - 16字节默认对齐
+ *   - 首次适应算法，空闲链表按地址排序
+ *   - 释放时立即与前后相邻的空闲块合并
+ *   - 16字节默认对齐，对齐填充留作空闲块
  *   - 魔数校验防野指针
  *   - 临界区保护（通过port层）
+ *   - 运行统计：标签记在块头的空余字节里，分配/释放时顺手累加，不额外占内存
  * 
- * 支持裸机内存池和FreeRTOS堆两种模式
+ * 支持裸机内存池和FreeRTOS堆两种模式；
+ * 裸机内存池可选 TLSF 算法（AkieGUI_MEM_ALLOCATOR，见 akiegui_tlsf.c）
  *
  * 许可证: AGPL v3 (看许可证文件)
  * 联系方式: xuelin-sherlyn@outlook.com
  * B站: https://space.bilibili.com/1815675515
  */
 #include "akiegui_memory.h"
+#include "akiegui_tlsf.h"
 #include "stdint.h"
 #include <string.h>
 
-#if !AkieGUI_USE_FREERTOS
+#define MEM_FIRST_FIT  (!AkieGUI_USE_FREERTOS && AkieGUI_MEM_ALLOCATOR == AkieGUI_MEM_FIRST_FIT)
+#define MEM_TLSF       (!AkieGUI_USE_FREERTOS && AkieGUI_MEM_ALLOCATOR == AkieGUI_MEM_TLSF)
+
+#if MEM_FIRST_FIT
 static AkieGUI_Mem_T g_mem;
 static uint8_t g_mem_inited = 0;
+
+#define MEM_HDR         ((uint32_t)sizeof(AkieGUI_Mem_Block_T))
+#define MEM_MAGIC_USED  0xFEEDBEEF
+#define MEM_MAGIC_FREE  0xDEADBEEF
+
+/* 块后面紧挨着的地址（下一个块头）*/
+static inline uint8_t* mem_block_end(AkieGUI_Mem_Block_T *b) {
+    return (uint8_t*)(b + 1) + b->size;
+}
 #endif
 
+/* 运行统计（都在临界区内更新）*/
+static struct {
+    uint32_t peak;
+    uint32_t fail_count;
+    AkieGUI_MemTagStat_T tag[AkieGUI_MEM_TAG_COUNT];
+} s_mem_stat;
+
+static inline void mem_stat_peak(uint32_t used) {
+    if (used > s_mem_stat.peak) s_mem_stat.peak = used;
+}
+
+static inline void mem_stat_alloc(uint8_t tag, uint32_t bytes) {
+    AkieGUI_MemTagStat_T *t = &s_mem_stat.tag[tag];
+    t->count++;
+    t->bytes += bytes;
+    if (t->bytes > t->peak) t->peak = t->bytes;
+}
+
+static inline void mem_stat_free(uint8_t tag, uint32_t bytes) {
+    AkieGUI_MemTagStat_T *t = &s_mem_stat.tag[tag];
+    t->count--;
+    t->bytes -= bytes;
+}
+
 /**
   * @brief	内存初始化
   *	@param	start: 起始内存指针
@@ -45,13 +85,29 @@ int AkieGUI_MemInit(void *start, uint32_t size) {
     }
     #endif
     return 0;
+#elif MEM_TLSF
+    uint32_t primask;  /* 保存中断状态 */
+    static uint8_t inited = 0;
+    int ret;
+    if (inited) return 0;
+    AkieGUI_ENTER_CRITICAL(primask);
+    ret = akiegui_tlsf_init(start, size);
+    inited = (ret == 0);
+    AkieGUI_EXIT_CRITICAL(primask);
+    return ret;
 #else
     uint32_t primask;  /* 保存中断状态 */
     /* 裸机版本：原有初始化代码 */
     if (g_mem_inited) return 0;
-    if (!start || size < sizeof(AkieGUI_Mem_Block_T) + AkieGUI_ALIGN) {
+    if (!start) return -1;
+
+    /* 块头按指针对齐 */
+    uintptr_t pad = AkieGUI_ALIGN_UP((uintptr_t)start, sizeof(uintptr_t)) - (uintptr_t)start;
+    if (size < pad + MEM_HDR + AkieGUI_ALIGN) {
         return -1;  /* 内存池太小 */
     }
+    start = (uint8_t*)start + pad;
+    size = (size - pad) & ~(uint32_t)(sizeof(uintptr_t) - 1);
 
     AkieGUI_ENTER_CRITICAL(primask);
     
@@ -62,9 +118,9 @@ int AkieGUI_MemInit(void *start, uint32_t size) {
     
     g_mem.free_list = (AkieGUI_Mem_Block_T*)start;
     g_mem.free_list->next = NULL;
-    g_mem.free_list->size = size - sizeof(AkieGUI_Mem_Block_T);
+    g_mem.free_list->size = size - MEM_HDR;
     g_mem.free_list->used = 0;
-    g_mem.free_list->magic = 0xDEADBEEF;
+    g_mem.free_list->magic = MEM_MAGIC_FREE;
     
     g_mem_inited = 1;
     AkieGUI_EXIT_CRITICAL(primask);
@@ -78,30 +134,61 @@ int AkieGUI_MemInit(void *start, uint32_t size) {
   * @retval	内存地址指针
 */
 void* AkieGUI_MemAlloc(uint32_t size) {
+    return AkieGUI_MemAllocTag(size, AkieGUI_MEM_TAG_OTHER);
+}
+
+/**
+  * @brief	内存对齐申请
+  * @param  size: 目标内存大小
+  * @param  align: 对齐大小
+  * @retval	内存地址指针
+*/
+void* AkieGUI_MemAllocAlign(uint32_t size, uint32_t align) {
+    return AkieGUI_MemAllocAlignTag(size, align, AkieGUI_MEM_TAG_OTHER);
+}
+
+/**
+  * @brief	带用途标签的内存申请
+  * @param  size: 目标内存大小
+  * @param  tag: 用途标签（AkieGUI_MemTag_T）
+  * @retval	内存地址指针
+*/
+void* AkieGUI_MemAllocTag(uint32_t size, uint8_t tag) {
 #if AkieGUI_USE_FREERTOS
+    uint32_t primask;  /* 保存中断状态 */
     void *ptr;
+    (void)tag;  /* FreeRTOS 堆没有地方记标签 */
+    AkieGUI_ENTER_CRITICAL(primask);
     ptr = pvPortMalloc(size);
+    if (!ptr) s_mem_stat.fail_count++;
+    #ifdef configTOTAL_HEAP_SIZE
+    mem_stat_peak(configTOTAL_HEAP_SIZE - xPortGetFreeHeapSize());
+    #endif
+    AkieGUI_EXIT_CRITICAL(primask);
     return ptr;
 #else
-    return AkieGUI_MemAllocAlign(size, AkieGUI_ALIGN);
+    return AkieGUI_MemAllocAlignTag(size, AkieGUI_ALIGN, tag);
 #endif
 }
 
 /**
-  * @brief	内存对齐申请
+  * @brief	带用途标签的内存对齐申请
   * @param  size: 目标内存大小
   * @param  align: 对齐大小
+  * @param  tag: 用途标签（AkieGUI_MemTag_T）
   * @retval	内存地址指针
 */
-void* AkieGUI_MemAllocAlign(uint32_t size, uint32_t align) {
+void* AkieGUI_MemAllocAlignTag(uint32_t size, uint32_t align, uint8_t tag) {
   uint32_t primask;  /* 保存中断状态 */
 
     if (size == 0) return NULL;
     if (align == 0 || (align & (align - 1)) != 0) {
         align = AkieGUI_ALIGN;  /* 回退到默认 */
     }
+    if (tag >= AkieGUI_MEM_TAG_COUNT) tag = AkieGUI_MEM_TAG_OTHER;
 #if AkieGUI_USE_FREERTOS
     void *ptr;
+    (void)tag;
     AkieGUI_ENTER_CRITICAL(primask);
     ptr = pvPortMalloc(size + align);
     if (ptr) {
@@ -112,24 +199,46 @@ void* AkieGUI_MemAllocAlign(uint32_t size, uint32_t align) {
             *p = aligned - addr;
             ptr = (void*)aligned;
         }
+    } else {
+        s_mem_stat.fail_count++;
+    }
+    #ifdef configTOTAL_HEAP_SIZE
+    mem_stat_peak(configTOTAL_HEAP_SIZE - xPortGetFreeHeapSize());
+    #endif
+    AkieGUI_EXIT_CRITICAL(primask);
+    return ptr;
+#elif MEM_TLSF
+    void *ptr;
+    AkieGUI_ENTER_CRITICAL(primask);   /* 耗时有上界，与内存池状态无关 */
+    ptr = akiegui_tlsf_alloc(size, align, tag);
+    if (ptr) {
+        mem_stat_alloc(tag, akiegui_tlsf_block_size(ptr, NULL));
+        mem_stat_peak(akiegui_tlsf_pool_size() - akiegui_tlsf_free_size());
+    } else {
+        s_mem_stat.fail_count++;
     }
     AkieGUI_EXIT_CRITICAL(primask);
     return ptr;
 #else
     if (!g_mem_inited || size == 0) return NULL;
+    if (align < sizeof(uintptr_t)) align = sizeof(uintptr_t);   /* 块头至少按指针对齐 */
     
     /* ===== 进入临界区！保护链表操作 ===== */
     AkieGUI_ENTER_CRITICAL(primask);
     
     size = AkieGUI_ALIGN_UP(size, align);
-    uint32_t total_size = size + sizeof(AkieGUI_Mem_Block_T) + align;
     
     AkieGUI_Mem_Block_T *prev = NULL;
     AkieGUI_Mem_Block_T *curr = g_mem.free_list;
+    uintptr_t pad = 0;
     
-    /* 遍历空闲链表 */
+    /* 遍历空闲链表（首次适应）：对齐填充要么为0，要么至少放得下一个块头 */
     while (curr) {
-        if (!curr->used && curr->size >= total_size) {
+        uintptr_t data = (uintptr_t)(curr + 1);
+        uintptr_t aligned = AkieGUI_ALIGN_UP(data, align);
+        while (aligned != data && aligned - data < MEM_HDR) aligned += align;
+        pad = aligned - data;
+        if (curr->size >= pad + size) {
             break;
         }
         prev = curr;
@@ -137,64 +246,50 @@ void* AkieGUI_MemAllocAlign(uint32_t size, uint32_t align) {
     }
     
     if (!curr) {
+        s_mem_stat.fail_count++;
         AkieGUI_EXIT_CRITICAL(primask);  /* 退出临界区 */
         return NULL;
     }
     
-    /* 对齐计算 */
-    uint8_t *data_ptr = (uint8_t*)curr + sizeof(AkieGUI_Mem_Block_T);
-    uint8_t *aligned_ptr = (uint8_t*)(((uint32_t)data_ptr + align - 1) & ~(align - 1));
-    uint32_t offset = aligned_ptr - data_ptr;
+    if (pad > 0) {
+        /* 对齐填充：前面剩下的部分仍是空闲块，新块接在它后面 */
+        AkieGUI_Mem_Block_T *block = (AkieGUI_Mem_Block_T*)((uint8_t*)(curr + 1) + pad) - 1;
+        block->size = curr->size - (uint32_t)pad;
+        block->next = curr->next;
+        curr->size = (uint32_t)pad - MEM_HDR;
+        curr->next = block;
+        prev = curr;
+        curr = block;
+    }
     
-    void *result = NULL;
+    /* 如果剩余空间足够，分割出后面的空闲块 */
+    if (curr->size >= size + MEM_HDR + AkieGUI_ALIGN) {
+        AkieGUI_Mem_Block_T *next_block = (AkieGUI_Mem_Block_T*)((uint8_t*)(curr + 1) + size);
+        next_block->next = curr->next;
+        next_block->size = curr->size - size - MEM_HDR;
+        next_block->used = 0;
+        next_block->magic = MEM_MAGIC_FREE;
+        curr->next = next_block;
+        curr->size = size;
+    }
     
-    if (offset > 0) {
-        /* 需要对齐填充，创建新块 */
-        AkieGUI_Mem_Block_T *new_block = 
-            (AkieGUI_Mem_Block_T*)(aligned_ptr - sizeof(AkieGUI_Mem_Block_T));
-        new_block->size = size;
-        new_block->used = 1;
-        new_block->magic = 0xFEEDBEEF;
-        new_block->next = NULL;
-        
-        /* 调整原空闲块 */
-        curr->size = aligned_ptr - (uint8_t*)curr - sizeof(AkieGUI_Mem_Block_T) * 2;
-        curr->used = 0;
-        
-        g_mem.free_size -= (size + sizeof(AkieGUI_Mem_Block_T));
-        g_mem.block_count++;
-        
-        result = (void*)(new_block + 1);
+    /* 从空闲链表摘下 */
+    if (prev) {
+        prev->next = curr->next;
     } else {
-        /* 直接使用当前块 */
-        curr->used = 1;
-        curr->size = size;
-        curr->magic = 0xFEEDBEEF;
-        
-        /* 如果剩余空间足够，分割内存 */
-        if (curr->size > size + sizeof(AkieGUI_Mem_Block_T) + AkieGUI_ALIGN) {
-            AkieGUI_Mem_Block_T *next_block = 
-                (AkieGUI_Mem_Block_T*)((uint8_t*)curr + sizeof(AkieGUI_Mem_Block_T) + size);
-            next_block->next = curr->next;
-            next_block->size = curr->size - size - sizeof(AkieGUI_Mem_Block_T);
-            next_block->used = 0;
-            next_block->magic = 0xDEADBEEF;
-            
-            if (prev) {
-                prev->next = next_block;
-            } else {
-                g_mem.free_list = next_block;
-            }
-            
-            curr->next = NULL;
-            curr->size = size;
-        }
-        
-        g_mem.free_size -= (curr->size + sizeof(AkieGUI_Mem_Block_T));
-        g_mem.block_count++;
-        
-        result = (void*)(curr + 1);
+        g_mem.free_list = curr->next;
     }
+    curr->next = NULL;
+    curr->used = 1;
+    curr->magic = MEM_MAGIC_USED;
+    curr->tag = tag;
+    
+    g_mem.free_size -= (curr->size + MEM_HDR);
+    g_mem.block_count++;
+    mem_stat_alloc(tag, curr->size + MEM_HDR);
+    mem_stat_peak(g_mem.pool_size - g_mem.free_size);
+    
+    void *result = (void*)(curr + 1);
     
     /* ===== 退出临界区 ===== */
     AkieGUI_EXIT_CRITICAL(primask);
@@ -211,18 +306,9 @@ void* AkieGUI_MemAllocAlign(uint32_t size, uint32_t align) {
 void* AkieGUI_MemCalloc(uint32_t nmemb, uint32_t size) {
     uint32_t total = nmemb * size;
     void *ptr = AkieGUI_MemAlloc(total);
-#if AkieGUI_USE_FREERTOS
+    /* 块已归调用者所有，清零不需要关中断 */
     if (ptr) memset(ptr, 0, total);
     return ptr;
-#else
-    if (ptr) {
-        uint32_t primask;  /* 保存中断状态 */
-        AkieGUI_ENTER_CRITICAL(primask);
-        memset(ptr, 0, total);
-        AkieGUI_EXIT_CRITICAL(primask);
-    }
-#endif
-    return ptr;
 }
 
 /**
@@ -244,6 +330,17 @@ void AkieGUI_MemFree(void *ptr) {
     }
     vPortFree((void*)orig);
     
+    AkieGUI_EXIT_CRITICAL(primask);
+#elif MEM_TLSF
+    uint8_t tag;
+    uint32_t bytes;
+    if (!ptr) return;
+    AkieGUI_ENTER_CRITICAL(primask);
+    bytes = akiegui_tlsf_block_size(ptr, &tag);
+    if (bytes) {
+        mem_stat_free(tag, bytes);
+        akiegui_tlsf_free(ptr);
+    }
     AkieGUI_EXIT_CRITICAL(primask);
 #else
     if (!ptr || !g_mem_inited) return;
@@ -254,20 +351,45 @@ void AkieGUI_MemFree(void *ptr) {
     AkieGUI_Mem_Block_T *block = (AkieGUI_Mem_Block_T*)ptr - 1;
     
     /* 验证魔数 */
-    if (block->magic != 0xFEEDBEEF) {
+    if (block->magic != MEM_MAGIC_USED) {
         AkieGUI_EXIT_CRITICAL(primask);
         return;
     }
     
     /* 标记为空闲 */
     block->used = 0;
-    block->magic = 0xDEADBEEF;
-    g_mem.free_size += (block->size + sizeof(AkieGUI_Mem_Block_T));
+    block->magic = MEM_MAGIC_FREE;
+    g_mem.free_size += (block->size + MEM_HDR);
     g_mem.block_count--;
+    mem_stat_free(block->tag, block->size + MEM_HDR);
     
-    /* 插入空闲链表头部 */
-    block->next = g_mem.free_list;
-    g_mem.free_list = block;
+    /* 按地址找到插入位置：prev < block < curr */
+    AkieGUI_Mem_Block_T *prev = NULL;
+    AkieGUI_Mem_Block_T *curr = g_mem.free_list;
+    while (curr && curr < block) {
+        prev = curr;
+        curr = curr->next;
+    }
+    
+    /* 与后一个空闲块相邻则合并 */
+    if (curr && mem_block_end(block) == (uint8_t*)curr) {
+        block->size += MEM_HDR + curr->size;
+        block->next = curr->next;
+        curr->magic = 0;
+    } else {
+        block->next = curr;
+    }
+    
+    /* 与前一个空闲块相邻则合并 */
+    if (prev && mem_block_end(prev) == (uint8_t*)block) {
+        prev->size += MEM_HDR + block->size;
+        prev->next = block->next;
+        block->magic = 0;
+    } else if (prev) {
+        prev->next = block;
+    } else {
+        g_mem.free_list = block;
+    }
     
     /* ===== 退出临界区 ===== */
     AkieGUI_EXIT_CRITICAL(primask);
@@ -285,6 +407,10 @@ uint32_t AkieGUI_MemGetFree(void) {
     AkieGUI_ENTER_CRITICAL(primask);
     free_size = xPortGetFreeHeapSize();
     AkieGUI_EXIT_CRITICAL(primask);
+#elif MEM_TLSF
+    AkieGUI_ENTER_CRITICAL(primask);
+    free_size = akiegui_tlsf_free_size();
+    AkieGUI_EXIT_CRITICAL(primask);
 #else
     AkieGUI_ENTER_CRITICAL(primask);
     free_size = g_mem.free_size;
@@ -304,6 +430,13 @@ uint32_t AkieGUI_MemGetUsed(void) {
     #else
         return 0;
     #endif
+#elif MEM_TLSF
+    uint32_t primask;  /* 保存中断状态 */
+    uint32_t used_size;
+    AkieGUI_ENTER_CRITICAL(primask);
+    used_size = akiegui_tlsf_pool_size() - akiegui_tlsf_free_size();
+    AkieGUI_EXIT_CRITICAL(primask);
+    return used_size;
 #else
     uint32_t primask;  /* 保存中断状态 */
     uint32_t used_size;
@@ -313,3 +446,58 @@ uint32_t AkieGUI_MemGetUsed(void) {
     return used_size;
 #endif
 }
+
+/**
+  * @brief	获得内存统计
+  * @param  stat: 输出（FreeRTOS 堆下最大空闲块、空闲块数、碎片率和按标签的用量为0）
+  * @note   首次适应要遍历空闲链表，TLSF 要遍历所有空闲链表
+*/
+void AkieGUI_MemGetStat(AkieGUI_MemStat_T *stat) {
+    uint32_t primask;  /* 保存中断状态 */
+    uint32_t free_size;
+    if (!stat) return;
+    memset(stat, 0, sizeof(*stat));
+
+    AkieGUI_ENTER_CRITICAL(primask);
+#if AkieGUI_USE_FREERTOS
+    free_size = xPortGetFreeHeapSize();
+    #ifdef configTOTAL_HEAP_SIZE
+    stat->total = configTOTAL_HEAP_SIZE;
+    #endif
+#elif MEM_TLSF
+    stat->total = akiegui_tlsf_pool_size();
+    free_size = akiegui_tlsf_free_size();
+    stat->largest_free = akiegui_tlsf_largest_free(&stat->free_blocks);
+#else
+    stat->total = g_mem.pool_size;
+    free_size = g_mem.free_size;
+    for (AkieGUI_Mem_Block_T *b = g_mem.free_list; b; b = b->next) {
+        if (b->size > stat->largest_free) stat->largest_free = b->size;
+        stat->free_blocks++;
+    }
+#endif
+    stat->peak = s_mem_stat.peak;
+    stat->fail_count = s_mem_stat.fail_count;
+    memcpy(stat->tag, s_mem_stat.tag, sizeof(stat->tag));
+    AkieGUI_EXIT_CRITICAL(primask);
+
+    stat->used = (stat->total > free_size) ? stat->total - free_size : 0;
+    /* 空闲内存里不能一次分配出去的比例（块头也算在内，只有一块空闲块时接近0）*/
+    if (free_size && stat->largest_free) {
+        stat->frag = (uint8_t)((uint64_t)(free_size - stat->largest_free) * 100 / free_size);
+    }
+}
+
+/**
+  * @brief	峰值从当前用量重新开始统计（比如进入新页面前调用）
+*/
+void AkieGUI_MemResetPeak(void) {
+    uint32_t primask;  /* 保存中断状态 */
+    uint32_t used = AkieGUI_MemGetUsed();
+    AkieGUI_ENTER_CRITICAL(primask);
+    s_mem_stat.peak = used;
+    for (uint32_t i = 0; i < AkieGUI_MEM_TAG_COUNT; i++) {
+        s_mem_stat.tag[i].peak = s_mem_stat.tag[i].bytes;
+    }
+    AkieGUI_EXIT_CRITICAL(primask);
+}
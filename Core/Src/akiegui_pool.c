@@ -0,0 +1,133 @@
+/* ============= akiegui_pool.c ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 定长对象池实现
+ *
+ * 块的布局：[块头（补齐到 AKIEGUI_POOL_ALIGN）][对象0][对象1]...
+ * 分配、释放时按地址找对象所在的块（块数不多，遍历块链表）
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#include "akiegui_pool.h"
+#include <stddef.h>
+
+/* 块头 */
+typedef struct pool_chunk {
+    struct pool_chunk *next;
+    uint16_t live;          /* 块里使用中的对象数 */
+} pool_chunk_t;
+
+#define POOL_CHUNK_HDR  ((uint32_t)AkieGUI_ALIGN_UP(sizeof(pool_chunk_t), AKIEGUI_POOL_ALIGN))
+
+static inline uint16_t pool_chunk_objs(const AkieGUI_Pool_T *pool) {
+    return pool->chunk ? pool->chunk : 1;
+}
+
+/* 对象所在的块，不是本池的对象返回NULL */
+static pool_chunk_t* pool_owner(const AkieGUI_Pool_T *pool, const void *obj) {
+    uint32_t span = pool->obj_size * pool_chunk_objs(pool);
+    for (pool_chunk_t *c = (pool_chunk_t*)pool->chunks; c; c = c->next) {
+        const uint8_t *base = (const uint8_t*)c + POOL_CHUNK_HDR;
+        if ((const uint8_t*)obj >= base && (const uint8_t*)obj < base + span) return c;
+    }
+    return NULL;
+}
+
+/* 把一块从块链表和空闲链表里摘下，还给内存池 */
+static void pool_release(AkieGUI_Pool_T *pool, pool_chunk_t *chunk) {
+    uint16_t n = pool_chunk_objs(pool);
+    uint8_t *base = (uint8_t*)chunk + POOL_CHUNK_HDR;
+    uint8_t *end = base + pool->obj_size * n;
+
+    void **link = &pool->free_list;
+    while (*link) {
+        uint8_t *obj = (uint8_t*)*link;
+        if (obj >= base && obj < end) *link = *(void**)obj;
+        else link = (void**)obj;
+    }
+
+    pool_chunk_t **cl = (pool_chunk_t**)&pool->chunks;
+    while (*cl != chunk) cl = &(*cl)->next;
+    *cl = chunk->next;
+
+    pool->capacity -= n;
+    AkieGUI_MemFree(chunk);
+}
+
+/**
+  * @brief	扩充一块，新对象挂到空闲链表
+  * @retval	0成功 -1内存不足
+*/
+static int pool_grow(AkieGUI_Pool_T *pool) {
+    uint16_t n = pool_chunk_objs(pool);
+    if ((uint32_t)pool->capacity + n > 0xFFFF) return -1;
+
+    pool_chunk_t *chunk = (pool_chunk_t*)AkieGUI_MemAllocTag(POOL_CHUNK_HDR + pool->obj_size * n, AkieGUI_MEM_TAG_WIDGET);
+    if (!chunk) return -1;
+
+    chunk->next = (pool_chunk_t*)pool->chunks;
+    chunk->live = 0;
+    pool->chunks = chunk;
+
+    /* 倒着挂，分配时按地址顺序取 */
+    uint8_t *obj = (uint8_t*)chunk + POOL_CHUNK_HDR + pool->obj_size * (n - 1);
+    for (uint16_t i = 0; i < n; i++, obj -= pool->obj_size) {
+        *(void**)obj = pool->free_list;
+        pool->free_list = obj;
+    }
+    pool->capacity += n;
+    return 0;
+}
+
+/**
+  * @brief	分配一个对象
+  * @param	pool: 对象池
+  * @retval	对象指针，内存不足返回NULL
+*/
+void* AkieGUI_Pool_Alloc(AkieGUI_Pool_T *pool) {
+    if (!pool) return NULL;
+    if (!pool->free_list && pool_grow(pool) != 0) return NULL;
+
+    void *obj = pool->free_list;
+    pool->free_list = *(void**)obj;
+    pool->used++;
+
+    pool_chunk_t *chunk = pool_owner(pool, obj);
+    chunk->live++;
+    if (chunk == pool->spare) pool->spare = NULL;
+    return obj;
+}
+
+/**
+  * @brief	释放一个对象
+  * @note   对象所在的块空了就还给内存池，只留一块空块备用；
+  *         最后一个对象释放时，备用块也还回去
+  * @param	pool: 对象池
+  * @param	obj: AkieGUI_Pool_Alloc 返回的指针
+*/
+void AkieGUI_Pool_Free(AkieGUI_Pool_T *pool, void *obj) {
+    if (!pool || !obj || pool->used == 0) return;
+
+    pool_chunk_t *chunk = pool_owner(pool, obj);
+    if (!chunk || chunk->live == 0) return;
+
+    *(void**)obj = pool->free_list;
+    pool->free_list = obj;
+    pool->used--;
+    if (--chunk->live) return;
+
+    if (pool->used == 0) {
+        /* 池空了：备用块和这一块都还回去 */
+        if (pool->spare && pool->spare != chunk) pool_release(pool, (pool_chunk_t*)pool->spare);
+        pool->spare = NULL;
+        pool_release(pool, chunk);
+    } else if (!pool->spare) {
+        pool->spare = chunk;
+    } else {
+        pool_release(pool, chunk);
+    }
+}
@@ -0,0 +1,175 @@
+/* ============= akiegui_tile.c ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 分块提交实现
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#include "akiegui_tile.h"
+#include <string.h>
+
+#if AkieGUI_TILE_SIZE
+
+#define TILE_COUNT      (AkieGUI_TILE_COLS * AkieGUI_TILE_ROWS)
+#define TILE_WORDS      ((TILE_COUNT + 31) / 32)
+
+#define BIT_GET(map, i) (((map)[(i) >> 5] >> ((i) & 31)) & 1u)
+#define BIT_SET(map, i) ((map)[(i) >> 5] |= 1u << ((i) & 31))
+#define BIT_CLR(map, i) ((map)[(i) >> 5] &= ~(1u << ((i) & 31)))
+
+static uint32_t s_tile_dirty[TILE_WORDS];      /* 需要检查/发送的块 */
+#if AkieGUI_TILE_HASH
+static uint32_t s_tile_valid[TILE_WORDS];      /* 校验和有效（等于屏幕上的内容）*/
+static uint32_t s_tile_hash[TILE_COUNT];       /* 上次发送时的校验和 */
+#endif
+
+/**
+  * @brief	区域换算成块的范围 [c0,c1) x [r0,r1)
+  * @retval	0有覆盖的块 -1空
+*/
+static int tile_range(uint16_t x, uint16_t y, uint16_t w, uint16_t h,
+                      uint16_t *c0, uint16_t *r0, uint16_t *c1, uint16_t *r1) {
+    uint32_t x1 = (uint32_t)x + w, y1 = (uint32_t)y + h;
+    if (x1 > g_akiegui.fb_width) x1 = g_akiegui.fb_width;
+    if (y1 > g_akiegui.fb_height) y1 = g_akiegui.fb_height;
+    if (w == 0 || h == 0 || x >= x1 || y >= y1) return -1;
+
+    *c0 = x / AkieGUI_TILE_SIZE;
+    *r0 = y / AkieGUI_TILE_SIZE;
+    *c1 = (uint16_t)((x1 + AkieGUI_TILE_SIZE - 1) / AkieGUI_TILE_SIZE);
+    *r1 = (uint16_t)((y1 + AkieGUI_TILE_SIZE - 1) / AkieGUI_TILE_SIZE);
+    if (*c1 > AkieGUI_TILE_COLS) *c1 = AkieGUI_TILE_COLS;
+    if (*r1 > AkieGUI_TILE_ROWS) *r1 = AkieGUI_TILE_ROWS;
+    return 0;
+}
+
+/**
+  * @brief	把区域覆盖的块置脏
+  * @param	x: X坐标
+  * @param	y: Y坐标
+  * @param	w: 宽度
+  * @param	h: 高度
+*/
+void AkieGUI_Tile_Invalidate(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    uint16_t c0, r0, c1, r1;
+    if (tile_range(x, y, w, h, &c0, &r0, &c1, &r1) != 0) return;
+
+    for (uint16_t r = r0; r < r1; r++) {
+        for (uint16_t c = c0; c < c1; c++) {
+            BIT_SET(s_tile_dirty, r * AkieGUI_TILE_COLS + c);
+        }
+    }
+}
+
+/**
+  * @brief	作废区域覆盖的块的校验和
+  * @param	x: X坐标
+  * @param	y: Y坐标
+  * @param	w: 宽度
+  * @param	h: 高度
+*/
+void AkieGUI_Tile_Forget(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+#if AkieGUI_TILE_HASH
+    uint16_t c0, r0, c1, r1;
+    if (tile_range(x, y, w, h, &c0, &r0, &c1, &r1) != 0) return;
+
+    for (uint16_t r = r0; r < r1; r++) {
+        for (uint16_t c = c0; c < c1; c++) {
+            BIT_CLR(s_tile_valid, r * AkieGUI_TILE_COLS + c);
+        }
+    }
+#else
+    (void)x; (void)y; (void)w; (void)h;
+#endif
+}
+
+#if AkieGUI_TILE_HASH
+/**
+  * @brief	块的校验和（按16位 FNV-1a）
+*/
+static uint32_t tile_hash(uint16_t c, uint16_t r) {
+    uint32_t bpp = g_akiegui.fb_bpp / 8;
+    uint32_t stride = g_akiegui.fb_width * bpp;
+    uint32_t x0 = (uint32_t)c * AkieGUI_TILE_SIZE, y0 = (uint32_t)r * AkieGUI_TILE_SIZE;
+    uint32_t x1 = x0 + AkieGUI_TILE_SIZE, y1 = y0 + AkieGUI_TILE_SIZE;
+    if (x1 > g_akiegui.fb_width) x1 = g_akiegui.fb_width;
+    if (y1 > g_akiegui.fb_height) y1 = g_akiegui.fb_height;
+
+    /* 16/24/32位色每行都是偶数字节（24位色按32位存放）*/
+    uint32_t halfs = (x1 - x0) * bpp / 2;
+    const uint8_t *row = (const uint8_t*)g_akiegui.draw_fb + y0 * stride + x0 * bpp;
+    uint32_t hash = 2166136261u;
+    for (uint32_t y = y0; y < y1; y++, row += stride) {
+        const uint16_t *p = (const uint16_t*)row;
+        for (uint32_t i = 0; i < halfs; i++) {
+            hash = (hash ^ p[i]) * 16777619u;
+        }
+    }
+    return hash;
+}
+#endif
+
+/**
+  * @brief	提交脏块中内容变化的部分
+  * @note   变化的块贪心合并成矩形：先向右延伸成一段，再向下延伸到不能整段覆盖为止
+  * @retval	发送的块数
+*/
+uint32_t AkieGUI_Tile_Flush(void) {
+    uint32_t sent = 0;
+
+    AkieGUI_GPU_Sync();
+
+#if AkieGUI_TILE_HASH
+    /* 校验和与上次发送时相同的块不用再发；变化的块先记下新校验和 */
+    static uint32_t s_new_hash[TILE_COUNT];
+    for (uint32_t i = 0; i < TILE_COUNT; i++) {
+        if (!BIT_GET(s_tile_dirty, i)) continue;
+        uint32_t hash = tile_hash((uint16_t)(i % AkieGUI_TILE_COLS), (uint16_t)(i / AkieGUI_TILE_COLS));
+        if (BIT_GET(s_tile_valid, i) && s_tile_hash[i] == hash) {
+            BIT_CLR(s_tile_dirty, i);
+        } else {
+            s_new_hash[i] = hash;
+        }
+    }
+#endif
+
+    for (uint16_t r = 0; r < AkieGUI_TILE_ROWS; r++) {
+        for (uint16_t c = 0; c < AkieGUI_TILE_COLS; c++) {
+            if (!BIT_GET(s_tile_dirty, r * AkieGUI_TILE_COLS + c)) continue;
+
+            uint16_t c1 = c + 1;
+            while (c1 < AkieGUI_TILE_COLS && BIT_GET(s_tile_dirty, r * AkieGUI_TILE_COLS + c1)) c1++;
+
+            uint16_t r1 = r + 1;
+            for (; r1 < AkieGUI_TILE_ROWS; r1++) {
+                uint16_t k = c;
+                while (k < c1 && BIT_GET(s_tile_dirty, r1 * AkieGUI_TILE_COLS + k)) k++;
+                if (k < c1) break;
+            }
+
+            uint16_t x = c * AkieGUI_TILE_SIZE, y = r * AkieGUI_TILE_SIZE;
+            uint16_t w = (uint16_t)((c1 - c) * AkieGUI_TILE_SIZE);
+            uint16_t h = (uint16_t)((r1 - r) * AkieGUI_TILE_SIZE);
+            AkieGUI_CommitRegion(x, y, w, h);   /* 会作废这些块的校验和，下面再补上 */
+
+            for (uint16_t rr = r; rr < r1; rr++) {
+                for (uint16_t cc = c; cc < c1; cc++) {
+                    uint32_t i = rr * AkieGUI_TILE_COLS + cc;
+                    BIT_CLR(s_tile_dirty, i);
+#if AkieGUI_TILE_HASH
+                    s_tile_hash[i] = s_new_hash[i];
+                    BIT_SET(s_tile_valid, i);
+#endif
+                }
+            }
+            sent += (uint32_t)(c1 - c) * (r1 - r);
+        }
+    }
+    return sent;
+}
+
+#endif
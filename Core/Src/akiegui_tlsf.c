@@ -0,0 +1,269 @@
+/* ============= akiegui_tlsf.c ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * TLSF 内存池实现
+ *
+ *   - 块大小以16字节为粒度，小于256字节的块在一级0里按16字节线性分类
+ *   - 每个块头记录物理上的前一块，末尾放一个大小为0的占用块当哨兵，合并不越界
+ *   - 对齐分配多找 align + 一个最小空闲块 的余量，前面的间隙拆成空闲块
+ *   - 没有任何随空闲块数增长的循环
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#include "akiegui_tlsf.h"
+#include "akiegui_memory.h"
+#include <stddef.h>
+#include <string.h>
+
+#if AkieGUI_MEM_ALLOCATOR == AkieGUI_MEM_TLSF
+
+#define TLSF_SL_LOG2     4                                  /* 一级内再分 16 份 */
+#define TLSF_SL_COUNT    (1u << TLSF_SL_LOG2)
+#define TLSF_GRAN_LOG2   4
+#define TLSF_GRAN        (1u << TLSF_GRAN_LOG2)             /* 块大小、块地址的粒度 */
+#define TLSF_FL_SHIFT    (TLSF_SL_LOG2 + TLSF_GRAN_LOG2)
+#define TLSF_SMALL       (1u << TLSF_FL_SHIFT)              /* 小块上限 */
+#define TLSF_FL_COUNT    (32 - TLSF_FL_SHIFT + 1)
+
+#define TLSF_MAGIC_USED  0xBEEF
+#define TLSF_MAGIC_FREE  0xDEAD
+
+/* 块头；next_free/prev_free 只在空闲块里有效，占用数据区开头 */
+typedef struct tlsf_block {
+    struct tlsf_block *prev_phys;   /* 物理上的前一块，第一块为NULL */
+    uint32_t size;                  /* 数据区字节数 */
+    uint16_t magic;                 /* 占用/空闲 */
+    uint16_t tag;                   /* 占用块的用途标签 */
+    struct tlsf_block *next_free;
+    struct tlsf_block *prev_free;
+} tlsf_block_t;
+
+#define TLSF_HDR  ((uint32_t)AkieGUI_ALIGN_UP(offsetof(tlsf_block_t, next_free), TLSF_GRAN))
+#define TLSF_MIN  ((uint32_t)AkieGUI_ALIGN_UP(sizeof(tlsf_block_t) - TLSF_HDR, TLSF_GRAN))
+
+static struct {
+    uint32_t fl_bitmap;                                 /* 哪些一级有空闲块 */
+    uint32_t sl_bitmap[TLSF_FL_COUNT];                  /* 每个一级里哪些二级有空闲块 */
+    tlsf_block_t *blocks[TLSF_FL_COUNT][TLSF_SL_COUNT];
+    uint8_t *pool_start;
+    uint8_t *pool_end;
+    uint32_t pool_size;
+    uint32_t free_size;
+} s_tlsf;
+
+/* 最高位的位置（x != 0）*/
+static inline uint32_t tlsf_fls(uint32_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 31 - (uint32_t)__builtin_clz(x);
+#else
+    uint32_t n = 0;
+    if (x & 0xFFFF0000u) { n += 16; x >>= 16; }
+    if (x & 0x0000FF00u) { n += 8;  x >>= 8;  }
+    if (x & 0x000000F0u) { n += 4;  x >>= 4;  }
+    if (x & 0x0000000Cu) { n += 2;  x >>= 2;  }
+    if (x & 0x00000002u) { n += 1; }
+    return n;
+#endif
+}
+
+/* 最低位的位置（x != 0）*/
+static inline uint32_t tlsf_ffs(uint32_t x) {
+    return tlsf_fls(x & (~x + 1));
+}
+
+static inline tlsf_block_t* tlsf_next_phys(tlsf_block_t *b) {
+    return (tlsf_block_t*)((uint8_t*)b + TLSF_HDR + b->size);
+}
+
+/* 大小 → 一级/二级下标 */
+static inline void tlsf_mapping(uint32_t size, uint32_t *fl, uint32_t *sl) {
+    if (size < TLSF_SMALL) {
+        *fl = 0;
+        *sl = size >> TLSF_GRAN_LOG2;
+    } else {
+        uint32_t f = tlsf_fls(size);
+        *sl = (size >> (f - TLSF_SL_LOG2)) ^ TLSF_SL_COUNT;
+        *fl = f - TLSF_FL_SHIFT + 1;
+    }
+}
+
+static void tlsf_insert(tlsf_block_t *b) {
+    uint32_t fl, sl;
+    tlsf_mapping(b->size, &fl, &sl);
+    b->magic = TLSF_MAGIC_FREE;
+    b->prev_free = NULL;
+    b->next_free = s_tlsf.blocks[fl][sl];
+    if (b->next_free) b->next_free->prev_free = b;
+    s_tlsf.blocks[fl][sl] = b;
+    s_tlsf.fl_bitmap |= 1u << fl;
+    s_tlsf.sl_bitmap[fl] |= 1u << sl;
+}
+
+static void tlsf_remove(tlsf_block_t *b) {
+    uint32_t fl, sl;
+    tlsf_mapping(b->size, &fl, &sl);
+    if (b->next_free) b->next_free->prev_free = b->prev_free;
+    if (b->prev_free) {
+        b->prev_free->next_free = b->next_free;
+    } else {
+        s_tlsf.blocks[fl][sl] = b->next_free;
+        if (!b->next_free) {
+            s_tlsf.sl_bitmap[fl] &= ~(1u << sl);
+            if (!s_tlsf.sl_bitmap[fl]) s_tlsf.fl_bitmap &= ~(1u << fl);
+        }
+    }
+}
+
+/* 找一个不小于 size 的空闲块：先把 size 上调到所在分类的上界，这一类里的任何块都够用 */
+static tlsf_block_t* tlsf_find(uint32_t size) {
+    uint32_t fl, sl;
+    if (size >= TLSF_SMALL) size += (1u << (tlsf_fls(size) - TLSF_SL_LOG2)) - 1;
+    tlsf_mapping(size, &fl, &sl);
+
+    uint32_t sl_map = s_tlsf.sl_bitmap[fl] & (~0u << sl);
+    if (!sl_map) {
+        uint32_t fl_map = (fl + 1 < 32) ? (s_tlsf.fl_bitmap & (~0u << (fl + 1))) : 0;
+        if (!fl_map) return NULL;
+        fl = tlsf_ffs(fl_map);
+        sl_map = s_tlsf.sl_bitmap[fl];
+    }
+    return s_tlsf.blocks[fl][tlsf_ffs(sl_map)];
+}
+
+int akiegui_tlsf_init(void *start, uint32_t size) {
+    uintptr_t pad = AkieGUI_ALIGN_UP((uintptr_t)start, TLSF_GRAN) - (uintptr_t)start;
+    if (!start || size < pad + TLSF_HDR * 2 + TLSF_MIN) return -1;
+    size = (size - (uint32_t)pad) & ~(TLSF_GRAN - 1);
+
+    memset(&s_tlsf, 0, sizeof(s_tlsf));
+    s_tlsf.pool_start = (uint8_t*)start + pad;
+    s_tlsf.pool_end = s_tlsf.pool_start + size;
+    s_tlsf.pool_size = size;
+
+    /* 一整块空闲块 + 末尾的哨兵 */
+    tlsf_block_t *b = (tlsf_block_t*)s_tlsf.pool_start;
+    b->prev_phys = NULL;
+    b->size = size - TLSF_HDR * 2;
+    tlsf_block_t *end = tlsf_next_phys(b);
+    end->prev_phys = b;
+    end->size = 0;
+    end->magic = TLSF_MAGIC_USED;
+    tlsf_insert(b);
+
+    s_tlsf.free_size = size - TLSF_HDR;
+    return 0;
+}
+
+void* akiegui_tlsf_alloc(uint32_t size, uint32_t align, uint8_t tag) {
+    if (!s_tlsf.pool_start || size == 0 || size > 0x80000000u) return NULL;
+    if (align < TLSF_GRAN) align = TLSF_GRAN;
+    size = (uint32_t)AkieGUI_ALIGN_UP(size, TLSF_GRAN);
+
+    /* 块地址天然按粒度对齐；更大的对齐要留出间隙，间隙要么为0，要么放得下一个空闲块 */
+    uint32_t gap_max = (align > TLSF_GRAN) ? align + TLSF_HDR + TLSF_MIN : 0;
+    tlsf_block_t *b = tlsf_find(size + gap_max);
+    if (!b) return NULL;
+    tlsf_remove(b);
+
+    if (gap_max) {
+        uintptr_t data = (uintptr_t)b + TLSF_HDR;
+        uintptr_t aligned = AkieGUI_ALIGN_UP(data, align);
+        if (aligned != data && aligned - data < TLSF_HDR + TLSF_MIN) aligned += align;
+        uint32_t gap = (uint32_t)(aligned - data);
+        if (gap) {
+            tlsf_block_t *nb = (tlsf_block_t*)(aligned - TLSF_HDR);
+            nb->prev_phys = b;
+            nb->size = b->size - gap;
+            tlsf_next_phys(nb)->prev_phys = nb;
+            b->size = gap - TLSF_HDR;
+            tlsf_insert(b);         /* 前一块一定是占用的，不用合并 */
+            b = nb;
+        }
+    }
+
+    /* 多出来的尾部拆成空闲块（后一块一定是占用的）*/
+    if (b->size >= size + TLSF_HDR + TLSF_MIN) {
+        tlsf_block_t *rest = (tlsf_block_t*)((uint8_t*)b + TLSF_HDR + size);
+        rest->prev_phys = b;
+        rest->size = b->size - size - TLSF_HDR;
+        tlsf_next_phys(rest)->prev_phys = rest;
+        b->size = size;
+        tlsf_insert(rest);
+    }
+
+    b->magic = TLSF_MAGIC_USED;
+    b->tag = tag;
+    s_tlsf.free_size -= b->size + TLSF_HDR;
+    return (uint8_t*)b + TLSF_HDR;
+}
+
+/* 指针对应的占用块，不是本池分配的返回NULL */
+static tlsf_block_t* tlsf_used_block(const void *ptr) {
+    if ((const uint8_t*)ptr < s_tlsf.pool_start + TLSF_HDR || (const uint8_t*)ptr >= s_tlsf.pool_end) return NULL;
+    tlsf_block_t *b = (tlsf_block_t*)((const uint8_t*)ptr - TLSF_HDR);
+    return (b->magic == TLSF_MAGIC_USED) ? b : NULL;
+}
+
+void akiegui_tlsf_free(void *ptr) {
+    tlsf_block_t *b = tlsf_used_block(ptr);
+    if (!b) return;
+    s_tlsf.free_size += b->size + TLSF_HDR;
+
+    /* 与后一块合并 */
+    tlsf_block_t *next = tlsf_next_phys(b);
+    if (next->magic == TLSF_MAGIC_FREE) {
+        tlsf_remove(next);
+        b->size += TLSF_HDR + next->size;
+        next->magic = 0;
+        tlsf_next_phys(b)->prev_phys = b;
+    }
+
+    /* 与前一块合并 */
+    tlsf_block_t *prev = b->prev_phys;
+    if (prev && prev->magic == TLSF_MAGIC_FREE) {
+        tlsf_remove(prev);
+        prev->size += TLSF_HDR + b->size;
+        b->magic = 0;
+        b = prev;
+        tlsf_next_phys(b)->prev_phys = b;
+    }
+
+    tlsf_insert(b);
+}
+
+uint32_t akiegui_tlsf_pool_size(void) {
+    return s_tlsf.pool_size;
+}
+
+uint32_t akiegui_tlsf_free_size(void) {
+    return s_tlsf.free_size;
+}
+
+uint32_t akiegui_tlsf_block_size(const void *ptr, uint8_t *tag) {
+    tlsf_block_t *b = tlsf_used_block(ptr);
+    if (!b) return 0;
+    if (tag) *tag = (uint8_t)b->tag;
+    return b->size + TLSF_HDR;
+}
+
+/* 遍历所有空闲链表；只在查询统计时调用 */
+uint32_t akiegui_tlsf_largest_free(uint32_t *count) {
+    uint32_t largest = 0, n = 0;
+    for (uint32_t fl_map = s_tlsf.fl_bitmap; fl_map; fl_map &= fl_map - 1) {
+        uint32_t fl = tlsf_ffs(fl_map);
+        for (uint32_t sl_map = s_tlsf.sl_bitmap[fl]; sl_map; sl_map &= sl_map - 1) {
+            for (tlsf_block_t *b = s_tlsf.blocks[fl][tlsf_ffs(sl_map)]; b; b = b->next_free) {
+                if (b->size > largest) largest = b->size;
+                n++;
+            }
+        }
+    }
+    if (count) *count = n;
+    return largest;
+}
+
+#endif
@@ -979,7 +979,10 @@ pFONT ASCII_8x16 = {
   16,
   16,
   0,
-  FONT_TYPE_ASCII
+  FONT_TYPE_ASCII,
+  NULL,
+  0,
+  1
 };
 
 pFONT ASCII_9x18 = {
@@ -988,7 +991,10 @@ pFONT ASCII_9x18 = {
   18,
   36,
   0,
-  FONT_TYPE_ASCII
+  FONT_TYPE_ASCII,
+  NULL,
+  0,
+  1
 };
 
 pFONT ASCII_10x20 = {
@@ -997,5 +1003,8 @@ pFONT ASCII_10x20 = {
   20,
   40,
   0,
-  FONT_TYPE_ASCII
+  FONT_TYPE_ASCII,
+  NULL,
+  0,
+  1
 };
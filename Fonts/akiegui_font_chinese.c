@@ -45,5 +45,8 @@ pFONT Chinese_20x20 = {
   20,
   60,
   sizeof(chinese_20x20)/sizeof(chinese_20x20[0]),
-  FONT_TYPE_GBK
+  FONT_TYPE_GBK,
+  NULL,
+  0,
+  1
 };
\ No newline at end of file
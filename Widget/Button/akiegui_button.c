@@ -10,20 +10,26 @@
  * B站: https://space.bilibili.com/1815675515
  */
 #include "akiegui_button.h"
+#include "akiegui_pool.h"
 #include "akiegui_color.h"
 #include "akiegui_draw.h"
 #include "akiegui_font_ascii.h"
 #include <string.h>
 
-#define MAX_BUTTONS 10  /* 最大按钮数量 */
-
-/* 按钮私有数据 - 静态数组 */
-static struct {
+/* 按钮对象池：控件和私有数据放在一起，用多少扩多少 */
+typedef struct {
     AkieGUI_Widget_T btn;
     Button_Private priv;
-} g_buttons[MAX_BUTTONS];
+} Button_Obj;
 
-static uint8_t g_button_count = 0;
+static AkieGUI_Pool_T g_button_pool = AKIEGUI_POOL_INIT(Button_Obj, AkieGUI_WIDGET_POOL_CHUNK);
+
+/**
+  * @brief	按钮删除时归还对象（控件是对象的第一个成员）
+*/
+static void button_destroy(AkieGUI_Widget_T *widget) {
+    AkieGUI_Pool_Free(&g_button_pool, widget);
+}
 
 /**
   * @brief	按钮绘制
@@ -86,10 +92,11 @@ AkieGUI_Widget_T* AkieGUI_Button_Create(
     uint32_t bg_color,
     uint32_t press_color
 ) {
-    if (g_button_count >= MAX_BUTTONS) return NULL;
+    Button_Obj *obj = (Button_Obj*)AkieGUI_Pool_Alloc(&g_button_pool);
+    if (!obj) return NULL;
     
-    AkieGUI_Widget_T *widget = &g_buttons[g_button_count].btn;
-    Button_Private *priv = &g_buttons[g_button_count].priv;
+    AkieGUI_Widget_T *widget = &obj->btn;
+    Button_Private *priv = &obj->priv;
     
     memset(widget, 0, sizeof(AkieGUI_Widget_T));
     memset(priv, 0, sizeof(Button_Private));
@@ -108,13 +115,16 @@ AkieGUI_Widget_T* AkieGUI_Button_Create(
     widget->w = w;
     widget->h = h;
     widget->state = AKIEGUI_STATE_VISIBLE | AKIEGUI_STATE_ENABLED;
+    if (AKIEGUI_COLOR_OPAQUE(bg_color) && AKIEGUI_COLOR_OPAQUE(press_color)) {
+        widget->state |= AKIEGUI_STATE_OPAQUE;     /* 背景盖满整个按钮 */
+    }
     widget->border_color = akiegui_argb888_to_native(0xFF000000);
     widget->border_width = 1;
     widget->dirty = 1;
     widget->draw = button_draw;
     widget->priv = priv;
+    widget->destroy = button_destroy;
     
-    g_button_count++;
     return widget;
 }
 
@@ -164,5 +174,10 @@ void AkieGUI_Button_SetColors(
     priv->text_color = akiegui_argb888_to_native(text_color);
     priv->bg_color = akiegui_argb888_to_native(bg_color);
     priv->press_color = akiegui_argb888_to_native(press_color);
+    if (AKIEGUI_COLOR_OPAQUE(bg_color) && AKIEGUI_COLOR_OPAQUE(press_color)) {
+        widget->state |= AKIEGUI_STATE_OPAQUE;
+    } else {
+        widget->state &= ~AKIEGUI_STATE_OPAQUE;
+    }
     widget->dirty = 1;
 }
\ No newline at end of file
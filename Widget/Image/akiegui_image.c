@@ -10,12 +10,12 @@
  * B站: https://space.bilibili.com/1815675515
  */
 #include "akiegui_image.h"
+#include "akiegui_pool.h"
 #include "akiegui_color.h"
 #include "akiegui_draw.h"
+#include "akiegui_blit.h"
 #include <string.h>
 
-#define MAX_IMAGES 10
-
 /**
   * @brief	图片控件私有数据
   */
@@ -24,26 +24,36 @@ typedef struct {
     uint8_t need_scale;                  /* 是否需要缩放（1=是，0=否）*/
 } Image_Private;
 
-/* 静态图片池 */
-static struct {
+/* 图片对象池：控件和私有数据放在一起，用多少扩多少 */
+typedef struct {
     AkieGUI_Widget_T widget;
     Image_Private priv;
-} g_images[MAX_IMAGES];
+} Image_Obj;
 
-static uint8_t g_image_count = 0;
+static AkieGUI_Pool_T g_image_pool = AKIEGUI_POOL_INIT(Image_Obj, AkieGUI_WIDGET_POOL_CHUNK);
+
+/**
+  * @brief	图片删除时归还对象（控件是对象的第一个成员）
+*/
+static void image_destroy(AkieGUI_Widget_T *widget) {
+    AkieGUI_Pool_Free(&g_image_pool, widget);
+}
+
+/* 开启混合时按像素 alpha 混合，否则直接复制 */
+#if AKIEGUI_ENABLE_BLEND
+#define IMAGE_BLIT_MODE  AKIEGUI_BLIT_ALPHA
+#else
+#define IMAGE_BLIT_MODE  AKIEGUI_BLIT_COPY
+#endif
 
 /**
-  * @brief	获取 RGB888 像素并转换为本地颜色格式
-  * @param	data: RGB888 数据指针
-  * @param	x: 像素 X 坐标
-  * @param	y: 像素 Y 坐标
-  * @param	width: 图片宽度
-  * @retval	转换后的本地颜色值
+  * @brief	图片数据的缓冲区描述（A,R,G,B 字节顺序，紧密排列）
+  * @param	info: 图片信息
+  * @param	surface: 输出的缓冲区描述
+  * @retval	无
   */
-static inline akiegui_color_t get_pixel(const uint8_t *data, uint16_t x, uint16_t y, uint16_t width) {
-    uint32_t idx = (y * width + x) * 4;
-    uint32_t rgb = (data[idx] << 24) | (data[idx + 1] << 16) | (data[idx + 2] << 8) | data[idx + 3];
-    return akiegui_argb888_to_native(rgb);
+static inline void image_surface(const AkieGUI_Image_Info_T *info, AkieGUI_Surface_T *surface) {
+    akiegui_surface_init(surface, (void*)info->data, info->width, info->height, AKIEGUI_FMT_ARGB8888_BE);
 }
 
 /**
@@ -55,7 +65,6 @@ static inline akiegui_color_t get_pixel(const uint8_t *data, uint16_t x, uint16_
   */
 static void draw_image_no_scale(void *fb, AkieGUI_Widget_T *widget, Image_Private *priv) {
     AkieGUI_Image_Info_T *info = &priv->img_info;
-    uint16_t fb_width = g_akiegui.fb_width;
     
     uint16_t draw_w = (widget->w < info->width) ? widget->w : info->width;
     uint16_t draw_h = (widget->h < info->height) ? widget->h : info->height;
@@ -64,29 +73,10 @@ static void draw_image_no_scale(void *fb, AkieGUI_Widget_T *widget, Image_Privat
     uint16_t start_x = widget->x + (widget->w - draw_w) / 2;
     uint16_t start_y = widget->y + (widget->h - draw_h) / 2;
     
-#if AkieGUI_LCD_BPP == 16
-    uint16_t *fb16 = (uint16_t*)fb;
-    for (uint16_t y = 0; y < draw_h; y++) {
-        for (uint16_t x = 0; x < draw_w; x++) {
-            akiegui_color_t color = get_pixel(info->data, x, y, info->width);
-            uint32_t fb_idx = (start_y + y) * fb_width + (start_x + x);
-            fb16[fb_idx] = color;
-        }
-    }
-#else
-    uint32_t *fb32 = (uint32_t*)fb;
-    for (uint16_t y = 0; y < draw_h; y++) {
-        for (uint16_t x = 0; x < draw_w; x++) {
-            akiegui_color_t color = get_pixel(info->data, x, y, info->width);
-            uint32_t fb_idx = (start_y + y) * fb_width + (start_x + x);
-#if AkieGUI_LCD_BPP == 32 && AKIEGUI_ENABLE_BLEND
-            fb32[fb_idx] = alpha_blend(fb32[fb_idx], color);
-#else
-            fb32[fb_idx] = color;
-#endif
-        }
-    }
-#endif
+    AkieGUI_Surface_T src;
+    AkieGUI_Rect_T area = { 0, 0, draw_w, draw_h };
+    image_surface(info, &src);
+    akiegui_draw_blit(fb, start_x, start_y, &src, &area, IMAGE_BLIT_MODE, 0);
 }
 
 /**
@@ -97,47 +87,9 @@ static void draw_image_no_scale(void *fb, AkieGUI_Widget_T *widget, Image_Privat
   * @retval	无
   */
 static void draw_image_scaled(void *fb, AkieGUI_Widget_T *widget, Image_Private *priv) {
-    AkieGUI_Image_Info_T *info = &priv->img_info;
-    uint16_t fb_width = g_akiegui.fb_width;
-    
-    float scale_x = (float)info->width / widget->w;
-    float scale_y = (float)info->height / widget->h;
-    
-#if AkieGUI_LCD_BPP == 16
-    uint16_t *fb16 = (uint16_t*)fb;
-    for (uint16_t y = 0; y < widget->h; y++) {
-        uint16_t src_y = (uint16_t)(y * scale_y);
-        if (src_y >= info->height) src_y = info->height - 1;
-        
-        for (uint16_t x = 0; x < widget->w; x++) {
-            uint16_t src_x = (uint16_t)(x * scale_x);
-            if (src_x >= info->width) src_x = info->width - 1;
-            
-            akiegui_color_t color = get_pixel(info->data, src_x, src_y, info->width);
-            uint32_t fb_idx = (widget->y + y) * fb_width + (widget->x + x);
-            fb16[fb_idx] = color;
-        }
-    }
-#else
-    uint32_t *fb32 = (uint32_t*)fb;
-    for (uint16_t y = 0; y < widget->h; y++) {
-        uint16_t src_y = (uint16_t)(y * scale_y);
-        if (src_y >= info->height) src_y = info->height - 1;
-        
-        for (uint16_t x = 0; x < widget->w; x++) {
-            uint16_t src_x = (uint16_t)(x * scale_x);
-            if (src_x >= info->width) src_x = info->width - 1;
-            
-            akiegui_color_t color = get_pixel(info->data, src_x, src_y, info->width);
-            uint32_t fb_idx = (widget->y + y) * fb_width + (widget->x + x);
-#if AkieGUI_LCD_BPP == 32 && AKIEGUI_ENABLE_BLEND
-            fb32[fb_idx] = alpha_blend(fb32[fb_idx], color);
-#else
-            fb32[fb_idx] = color;
-#endif
-        }
-    }
-#endif
+    AkieGUI_Surface_T src;
+    image_surface(&priv->img_info, &src);
+    akiegui_draw_blit_scaled(fb, widget->x, widget->y, widget->w, widget->h, &src, IMAGE_BLIT_MODE, 0);
 }
 
 /**
@@ -174,10 +126,11 @@ AkieGUI_Widget_T* AkieGUI_Image_Create(
     uint16_t w, uint16_t h,
     AkieGUI_Image_Info_T *img_info
 ) {
-    if (g_image_count >= MAX_IMAGES) return NULL;
+    Image_Obj *obj = (Image_Obj*)AkieGUI_Pool_Alloc(&g_image_pool);
+    if (!obj) return NULL;
     
-    AkieGUI_Widget_T *widget = &g_images[g_image_count].widget;
-    Image_Private *priv = &g_images[g_image_count].priv;
+    AkieGUI_Widget_T *widget = &obj->widget;
+    Image_Private *priv = &obj->priv;
     
     memset(widget, 0, sizeof(AkieGUI_Widget_T));
     memset(priv, 0, sizeof(Image_Private));
@@ -202,8 +155,8 @@ AkieGUI_Widget_T* AkieGUI_Image_Create(
     widget->dirty = 1;
     widget->draw = image_draw;
     widget->priv = priv;
+    widget->destroy = image_destroy;
     
-    g_image_count++;
     return widget;
 }
 
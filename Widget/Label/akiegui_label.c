@@ -10,10 +10,9 @@
  * B站: https://space.bilibili.com/1815675515
  */
 #include "akiegui_label.h"
+#include "akiegui_pool.h"
 #include "akiegui_draw.h"
 
-#define MAX_LABELS 10
-
 /* 标签私有数据 */
 typedef struct {
     char text[64];               /* 文字内容 */
@@ -24,13 +23,20 @@ typedef struct {
     uint8_t transparent;         /* 1=背景透明，只画文字 */
 } Label_Private;
 
-/* 静态标签池 */
-static struct {
+/* 标签对象池：控件和私有数据放在一起，用多少扩多少 */
+typedef struct {
     AkieGUI_Widget_T label;
     Label_Private priv;
-} g_labels[MAX_LABELS];
+} Label_Obj;
 
-static uint8_t g_label_count = 0;
+static AkieGUI_Pool_T g_label_pool = AKIEGUI_POOL_INIT(Label_Obj, AkieGUI_WIDGET_POOL_CHUNK);
+
+/**
+  * @brief	标签删除时归还对象（控件是对象的第一个成员）
+*/
+static void label_destroy(AkieGUI_Widget_T *widget) {
+    AkieGUI_Pool_Free(&g_label_pool, widget);
+}
 
 /**
   * @brief	标签绘制
@@ -101,10 +107,11 @@ AkieGUI_Widget_T* AkieGUI_Label_Create(
     uint32_t bg_color,
     pFONT *font
 ) {
-    if (g_label_count >= MAX_LABELS) return NULL;
+    Label_Obj *obj = (Label_Obj*)AkieGUI_Pool_Alloc(&g_label_pool);
+    if (!obj) return NULL;
     
-    AkieGUI_Widget_T *widget = &g_labels[g_label_count].label;
-    Label_Private *priv = &g_labels[g_label_count].priv;
+    AkieGUI_Widget_T *widget = &obj->label;
+    Label_Private *priv = &obj->priv;
     
     memset(widget, 0, sizeof(AkieGUI_Widget_T));
     memset(priv, 0, sizeof(Label_Private));
@@ -132,11 +139,14 @@ AkieGUI_Widget_T* AkieGUI_Label_Create(
     widget->w = width;
     widget->h = height;
     widget->state = AKIEGUI_STATE_VISIBLE | AKIEGUI_STATE_ENABLED;
+    if (!priv->transparent && AKIEGUI_COLOR_OPAQUE(bg_color)) {
+        widget->state |= AKIEGUI_STATE_OPAQUE;     /* 背景盖满整个标签 */
+    }
     widget->dirty = 1;
     widget->draw = label_draw;
     widget->priv = priv;
+    widget->destroy = label_destroy;
     
-    g_label_count++;
     return widget;
 }
 
@@ -159,10 +169,11 @@ AkieGUI_Widget_T* AkieGUI_Label_Create_Chinese(
     pFONT *ascii_font,
     pFONT *ch_font
 ) {
-    if (g_label_count >= MAX_LABELS) return NULL;
+    Label_Obj *obj = (Label_Obj*)AkieGUI_Pool_Alloc(&g_label_pool);
+    if (!obj) return NULL;
     
-    AkieGUI_Widget_T *widget = &g_labels[g_label_count].label;
-    Label_Private *priv = &g_labels[g_label_count].priv;
+    AkieGUI_Widget_T *widget = &obj->label;
+    Label_Private *priv = &obj->priv;
     
     memset(widget, 0, sizeof(AkieGUI_Widget_T));
     memset(priv, 0, sizeof(Label_Private));
@@ -187,11 +198,14 @@ AkieGUI_Widget_T* AkieGUI_Label_Create_Chinese(
     widget->w = width;
     widget->h = height;
     widget->state = AKIEGUI_STATE_VISIBLE | AKIEGUI_STATE_ENABLED;
+    if (!priv->transparent && AKIEGUI_COLOR_OPAQUE(bg_color)) {
+        widget->state |= AKIEGUI_STATE_OPAQUE;     /* 背景盖满整个标签 */
+    }
     widget->dirty = 1;
     widget->draw = label_draw_mixed;
     widget->priv = priv;
+    widget->destroy = label_destroy;
     
-    g_label_count++;
     return widget;
 }
 
@@ -261,5 +275,10 @@ void AkieGUI_Label_SetBgColor(AkieGUI_Widget_T *widget, uint32_t bg_color) {
 #else
     priv->transparent = ((bg_color >> 24) == 0);
 #endif
+    if (!priv->transparent && AKIEGUI_COLOR_OPAQUE(bg_color)) {
+        widget->state |= AKIEGUI_STATE_OPAQUE;
+    } else {
+        widget->state &= ~AKIEGUI_STATE_OPAQUE;
+    }
     widget->dirty = 1;
 }
\ No newline at end of file
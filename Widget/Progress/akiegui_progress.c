@@ -10,20 +10,40 @@
  * B站: https://space.bilibili.com/1815675515
  */
 #include "akiegui_progress.h"
+#include "akiegui_pool.h"
 #include "akiegui_color.h"
 #include "akiegui_draw.h"
 #include <stdint.h>
 #include <string.h>
-#include <stdio.h>
 
-#define MAX_PROGRESS 4
-
-static struct {
+/* 进度条对象池：控件和私有数据放在一起，用多少扩多少 */
+typedef struct {
     AkieGUI_Widget_T widget;
     Progress_Private priv;
-} g_progresses[MAX_PROGRESS];
+} Progress_Obj;
+
+static AkieGUI_Pool_T g_progress_pool = AKIEGUI_POOL_INIT(Progress_Obj, AkieGUI_WIDGET_POOL_CHUNK);
+
+/**
+  * @brief	进度条删除时归还对象（控件是对象的第一个成员）
+*/
+static void progress_destroy(AkieGUI_Widget_T *widget) {
+    AkieGUI_Pool_Free(&g_progress_pool, widget);
+}
 
-static uint8_t g_progress_count = 0;
+/**
+  * @brief	百分比转文字（如 "42%"）
+  * @param  buf: 至少5字节（最长 "100%"）
+  * @param  percent: 百分比（0~100）
+*/
+static void percent_text(char *buf, uint16_t percent) {
+    char *p = buf;
+    if (percent >= 100) *p++ = '0' + percent / 100;
+    if (percent >= 10) *p++ = '0' + percent / 10 % 10;
+    *p++ = '0' + percent % 10;
+    *p++ = '%';
+    *p = '\0';
+}
 
 static void progress_draw(AkieGUI_Widget_T *widget, void *fb) {
     Progress_Private *priv = (Progress_Private*)widget->priv;
@@ -50,11 +70,10 @@ static void progress_draw(AkieGUI_Widget_T *widget, void *fb) {
                           priv->border_width, widget->h, priv->border_color);
     }
 
-    /* 百分比文字 */
+    /* 百分比文字（长度固定，放在栈上；显示列表只记字模地址，不引用这块缓冲）*/
     if (priv->show_percent && priv->font) {
-        char buf[8];
-        uint16_t percent = (uint16_t)((uint32_t)priv->value * 100 / priv->max);
-        snprintf(buf, sizeof(buf), "%d%%", percent);
+        char buf[5];
+        percent_text(buf, (uint16_t)((uint32_t)priv->value * 100 / priv->max));
         uint16_t tw = akiegui_text_width(buf, priv->font);
         uint16_t th = priv->font->Height;
         uint16_t tx = widget->x + (widget->w - tw) / 2;
@@ -76,10 +95,11 @@ AkieGUI_Widget_T* AkieGUI_Progress_Create(
     uint32_t bg_color,
     uint32_t bar_color
 ) {
-    if (g_progress_count >= MAX_PROGRESS) return NULL;
+    Progress_Obj *obj = (Progress_Obj*)AkieGUI_Pool_Alloc(&g_progress_pool);
+    if (!obj) return NULL;
 
-    AkieGUI_Widget_T *widget = &g_progresses[g_progress_count].widget;
-    Progress_Private *priv = &g_progresses[g_progress_count].priv;
+    AkieGUI_Widget_T *widget = &obj->widget;
+    Progress_Private *priv = &obj->priv;
 
     memset(widget, 0, sizeof(AkieGUI_Widget_T));
     memset(priv, 0, sizeof(Progress_Private));
@@ -98,11 +118,14 @@ AkieGUI_Widget_T* AkieGUI_Progress_Create(
     widget->h = h;
     widget->type = AKIEGUI_WIDGET_PROGRESS;
     widget->state = AKIEGUI_STATE_VISIBLE | AKIEGUI_STATE_ENABLED;
+    if (AKIEGUI_COLOR_OPAQUE(bg_color)) {
+        widget->state |= AKIEGUI_STATE_OPAQUE;     /* 背景盖满整个进度条 */
+    }
     widget->dirty = 1;
     widget->draw = progress_draw;
     widget->priv = priv;
+    widget->destroy = progress_destroy;
 
-    g_progress_count++;
     return widget;
 }
 
@@ -11,22 +11,147 @@
  */
 #include "akiegui_widget.h"
 #include "akiegui_core.h"
-#include "usart.h"
+#include "akiegui_draw.h"
+#include "akiegui_blend.h"
+#include "akiegui_gpu.h"
+#include "akiegui_tile.h"
+#include "akiegui_dlist.h"
+#include "akiegui_arena.h"
 #include <string.h>
 
-#define MAX_WIDGETS 20
+#define MAX_WIDGETS AkieGUI_WIDGET_MAX
 
 static struct {
     AkieGUI_Widget_T *widgets[MAX_WIDGETS];
     uint8_t count;
 } g_widget_list;
 
-/* 全局脏矩形区域（用于局部刷新）*/
-static uint16_t dirty_min_x = 0xFFFF;
-static uint16_t dirty_min_y = 0xFFFF;
-static uint16_t dirty_max_x = 0;
-static uint16_t dirty_max_y = 0;
-static uint8_t *g_backup_fb = NULL;
+/* 脏矩形列表（用于局部刷新），没有一个包含另一个 */
+static AkieGUI_Rect_T s_damage[AkieGUI_DAMAGE_MAX];
+static uint8_t s_damage_count = 0;
+
+/* 背景层：重绘时没被不透明控件盖住的部分从这里恢复 */
+#define AKIEGUI_BG_NONE     0   /* 没有背景层，不恢复 */
+#define AKIEGUI_BG_COLOR    1   /* 纯色 */
+#define AKIEGUI_BG_COPY     2   /* 整屏副本 */
+static struct {
+    uint8_t *buf;               /* 整屏副本（只分配一次）*/
+    akiegui_color_t color;      /* 纯色背景的颜色 */
+    uint8_t mode;
+} s_bg;
+
+#if AkieGUI_DLIST_SIZE
+/* 显示列表：每个控件的命令范围 [s_dl_from, s_dl_to) */
+static uintptr_t s_dl_buf[(AkieGUI_DLIST_SIZE + sizeof(uintptr_t) - 1) / sizeof(uintptr_t)];
+static AkieGUI_DList_T s_dl;
+static uint32_t s_dl_from[MAX_WIDGETS];
+static uint32_t s_dl_to[MAX_WIDGETS];
+static uint8_t s_dl_ready = 0;      /* 1=用录制的命令代替绘制函数 */
+#endif
+
+static inline uint32_t rect_area(const AkieGUI_Rect_T *r) {
+    return (uint32_t)r->w * r->h;
+}
+
+static inline uint8_t rect_contains(const AkieGUI_Rect_T *a, const AkieGUI_Rect_T *b) {
+    return b->x >= a->x && b->y >= a->y &&
+           b->x + b->w <= a->x + a->w && b->y + b->h <= a->y + a->h;
+}
+
+static inline uint8_t rect_overlap(const AkieGUI_Rect_T *a, const AkieGUI_Rect_T *b) {
+    return a->x < b->x + b->w && b->x < a->x + a->w &&
+           a->y < b->y + b->h && b->y < a->y + a->h;
+}
+
+static void rect_union(const AkieGUI_Rect_T *a, const AkieGUI_Rect_T *b, AkieGUI_Rect_T *out) {
+    uint16_t x0 = (a->x < b->x) ? a->x : b->x;
+    uint16_t y0 = (a->y < b->y) ? a->y : b->y;
+    uint16_t x1 = (a->x + a->w > b->x + b->w) ? a->x + a->w : b->x + b->w;
+    uint16_t y1 = (a->y + a->h > b->y + b->h) ? a->y + a->h : b->y + b->h;
+    out->x = x0;
+    out->y = y0;
+    out->w = x1 - x0;
+    out->h = y1 - y0;
+}
+
+/**
+  * @brief	a 减去 c，剩下的部分拆成最多4块（上、下、左、右）
+  * @retval	块数（a 与 c 不相交时为 a 本身）
+*/
+static uint8_t rect_subtract(const AkieGUI_Rect_T *a, const AkieGUI_Rect_T *c, AkieGUI_Rect_T out[4]) {
+    if (!rect_overlap(a, c)) {
+        out[0] = *a;
+        return 1;
+    }
+
+    uint8_t n = 0;
+    uint16_t ax1 = a->x + a->w, ay1 = a->y + a->h;
+    uint16_t cx1 = c->x + c->w, cy1 = c->y + c->h;
+    /* 中间一条：与 c 同高的部分 */
+    uint16_t my0 = (c->y > a->y) ? c->y : a->y;
+    uint16_t my1 = (cy1 < ay1) ? cy1 : ay1;
+
+    if (c->y > a->y) out[n++] = (AkieGUI_Rect_T){ a->x, a->y, a->w, (uint16_t)(c->y - a->y) };
+    if (cy1 < ay1)   out[n++] = (AkieGUI_Rect_T){ a->x, cy1, a->w, (uint16_t)(ay1 - cy1) };
+    if (c->x > a->x) out[n++] = (AkieGUI_Rect_T){ a->x, my0, (uint16_t)(c->x - a->x), (uint16_t)(my1 - my0) };
+    if (cx1 < ax1)   out[n++] = (AkieGUI_Rect_T){ cx1, my0, (uint16_t)(ax1 - cx1), (uint16_t)(my1 - my0) };
+    return n;
+}
+
+/**
+  * @brief	两个矩形合并成包围盒比分开多出的像素数（<=0 表示合并不吃亏）
+*/
+static int32_t merge_cost(const AkieGUI_Rect_T *a, const AkieGUI_Rect_T *b) {
+    AkieGUI_Rect_T u;
+    rect_union(a, b, &u);
+    return (int32_t)rect_area(&u) - (int32_t)rect_area(a) - (int32_t)rect_area(b);
+}
+
+/**
+  * @brief	加入一个脏矩形
+  * @note   合并不吃亏时合并；列表满时与代价最小的一个合并；
+  *         总面积超过 AkieGUI_DAMAGE_FULL_PERCENT 时改为整屏
+*/
+static void damage_add(int32_t x, int32_t y, int32_t w, int32_t h) {
+    int32_t x1 = x + w, y1 = y + h;
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x1 > (int32_t)g_akiegui.fb_width) x1 = g_akiegui.fb_width;
+    if (y1 > (int32_t)g_akiegui.fb_height) y1 = g_akiegui.fb_height;
+    if (x1 <= x || y1 <= y) return;
+
+    AkieGUI_Rect_T r = { (uint16_t)x, (uint16_t)y, (uint16_t)(x1 - x), (uint16_t)(y1 - y) };
+
+    for (;;) {
+        int8_t best = -1;
+        int32_t best_cost = INT32_MAX;
+        for (uint8_t i = 0; i < s_damage_count; i++) {
+            if (rect_contains(&s_damage[i], &r)) return;
+            int32_t cost = merge_cost(&s_damage[i], &r);
+            if (cost < best_cost) {
+                best_cost = cost;
+                best = (int8_t)i;
+            }
+        }
+        if (best < 0 || (best_cost > 0 && s_damage_count < AkieGUI_DAMAGE_MAX)) break;
+
+        /* 合并后的矩形可能又能与其他矩形合并，继续找 */
+        rect_union(&s_damage[best], &r, &r);
+        s_damage[best] = s_damage[--s_damage_count];
+    }
+    s_damage[s_damage_count++] = r;
+
+    uint32_t total = 0;
+    for (uint8_t i = 0; i < s_damage_count; i++) total += rect_area(&s_damage[i]);
+    uint32_t screen = (uint32_t)g_akiegui.fb_width * g_akiegui.fb_height;
+    if (total * 100 > screen * AkieGUI_DAMAGE_FULL_PERCENT) {
+        s_damage[0].x = 0;
+        s_damage[0].y = 0;
+        s_damage[0].w = g_akiegui.fb_width;
+        s_damage[0].h = g_akiegui.fb_height;
+        s_damage_count = 1;
+    }
+}
 
 /**
   * @brief	Widget初始化
@@ -46,20 +171,108 @@ void AkieGUI_Widget_Add(AkieGUI_Widget_T *widget) {
 }
 
 /**
-  * @brief	备份背景
+  * @brief	恢复背景层的一块区域
+  * @param	fb: 目标帧缓冲
+  * @param	r: 区域（已在帧缓冲范围内）
+*/
+static void bg_restore(void *fb, const AkieGUI_Rect_T *r) {
+    if (s_bg.mode == AKIEGUI_BG_COLOR) {
+        uint8_t opa = g_akiegui.draw_opa;
+        g_akiegui.draw_opa = AKIEGUI_OPA_COVER;
+        akiegui_draw_rect(fb, r->x, r->y, r->w, r->h, s_bg.color);
+        g_akiegui.draw_opa = opa;
+        return;
+    }
+
+    /* 整屏副本：逐行复制 */
+    uint32_t bpp = g_akiegui.fb_bpp / 8;
+    uint32_t stride = g_akiegui.fb_width * bpp;
+    uint32_t offset = r->y * stride + r->x * bpp;
+
+    akiegui_gpu_wait_rect(fb, r->x, r->y, r->w, r->h);
+    for (uint16_t j = 0; j < r->h; j++, offset += stride) {
+        memcpy((uint8_t*)fb + offset, s_bg.buf + offset, r->w * bpp);
+    }
+}
+
+/**
+  * @brief	把区域裁剪到帧缓冲范围内
+  * @retval	1有剩余 0完全在外面
+*/
+static uint8_t bg_clip(uint16_t x, uint16_t y, uint16_t w, uint16_t h, AkieGUI_Rect_T *r) {
+    if (w == 0 || h == 0 || x >= g_akiegui.fb_width || y >= g_akiegui.fb_height) return 0;
+    if (x + w > g_akiegui.fb_width) w = g_akiegui.fb_width - x;
+    if (y + h > g_akiegui.fb_height) h = g_akiegui.fb_height - y;
+    r->x = x;
+    r->y = y;
+    r->w = w;
+    r->h = h;
+    return 1;
+}
+
+/**
+  * @brief	把绘制缓冲的当前内容整屏保存为背景层
+  * @note   副本只分配一次，之后再调用直接覆盖；分段渲染时没有整屏缓冲，不做备份
 */
 void AkieGUI_BackupBackground(void) {
-    g_backup_fb = (uint8_t*)AkieGUI_MemAlloc(g_akiegui.fb_size);
-    memcpy(g_backup_fb, AkieGUI_GetDrawFB(), g_akiegui.fb_size);
+#if !AkieGUI_BAND_LINES
+    if (!s_bg.buf) {
+        s_bg.buf = (uint8_t*)AkieGUI_MemAllocTag(g_akiegui.fb_size, AkieGUI_MEM_TAG_BG);
+        if (!s_bg.buf) return;
+    }
+    void *fb = AkieGUI_GetDrawFB();
+    AkieGUI_GPU_Sync();         /* 读绘制缓冲前等加速器写完 */
+    memcpy(s_bg.buf, fb, g_akiegui.fb_size);
+    s_bg.mode = AKIEGUI_BG_COPY;
+#endif
+}
+
+/**
+  * @brief	把绘制缓冲的一块区域更新到背景层（背景层须为整屏副本）
+*/
+void AkieGUI_BackupBackgroundArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+    AkieGUI_Rect_T r;
+    if (s_bg.mode != AKIEGUI_BG_COPY || !bg_clip(x, y, w, h, &r)) return;
+
+    uint32_t bpp = g_akiegui.fb_bpp / 8;
+    uint32_t stride = g_akiegui.fb_width * bpp;
+    uint32_t offset = r.y * stride + r.x * bpp;
+    uint8_t *fb = (uint8_t*)AkieGUI_GetDrawFB();
+
+    AkieGUI_GPU_Sync();         /* 读绘制缓冲前等加速器写完 */
+    for (uint16_t j = 0; j < r.h; j++, offset += stride) {
+        memcpy(s_bg.buf + offset, fb + offset, r.w * bpp);
+    }
 }
 
 /**
-  * @brief	恢复背景
+  * @brief	背景层改为纯色（不占整屏内存，分段渲染时也可用）
+  * @param	color: 背景色
+*/
+void AkieGUI_SetBackgroundColor(akiegui_color_t color) {
+    AkieGUI_FreeBackground();
+    s_bg.color = color;
+    s_bg.mode = AKIEGUI_BG_COLOR;
+}
+
+/**
+  * @brief	释放背景层，之后重绘不再恢复背景
+*/
+void AkieGUI_FreeBackground(void) {
+    if (s_bg.buf) {
+        AkieGUI_MemFree(s_bg.buf);
+        s_bg.buf = NULL;
+    }
+    s_bg.mode = AKIEGUI_BG_NONE;
+}
+
+/**
+  * @brief	把一块区域的背景恢复到绘制缓冲（不提交）
 */
 void AkieGUI_RestoreBackgroundArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
-    safe_printf("\033[32m[LOG_I] Restore rect: [%d,%d %dx%d]\033[0m\r\n", x, y, w, h);
-    uint32_t offset = (y * g_akiegui.fb_width + x) * (g_akiegui.fb_bpp / 8);
-    g_akiegui.send_region(x, y, w, h, g_backup_fb + offset);
+    AkieGUI_Rect_T r;
+    if (s_bg.mode == AKIEGUI_BG_NONE || !bg_clip(x, y, w, h, &r)) return;
+    bg_restore(AkieGUI_GetDrawFB(), &r);
 }
 
 /**
@@ -101,27 +314,46 @@ void AkieGUI_Widget_RemoveAll(void) {
 }
 
 /**
-  * @brief	标记控件脏，并扩展全局脏矩形
+  * @brief	删除控件：从管理器移除，露出的区域加入脏矩形列表，归还控件内存
+  * @note   之后不能再使用这个控件指针
   * @param	widget: 控件句柄
   */
-void AkieGUI_Widget_MarkDirty(AkieGUI_Widget_T *widget) {
+void AkieGUI_Widget_Delete(AkieGUI_Widget_T *widget) {
     if (!widget) return;
 
-    // 1. 原有控件脏标记
-    widget->dirty = 1;
+    if (AkieGUI_Widget_Contains(widget) && (widget->state & AKIEGUI_STATE_VISIBLE)) {
+        AkieGUI_Widget_MarkRegionDirty(widget->x, widget->y, widget->w, widget->h);
+    }
+    AkieGUI_Widget_Remove(widget);
+    AkieGUI_Touch_Forget(widget);
+    if (widget->destroy) widget->destroy(widget);
+}
 
-    // 2. 扩展全局脏矩形（包含控件全部区域）
-    uint16_t right = widget->x + widget->w;
-    uint16_t bottom = widget->y + widget->h;
+/**
+  * @brief	控件是否在管理器中
+  * @param	widget: 控件句柄
+  * @retval	1在 0不在
+  */
+uint8_t AkieGUI_Widget_Contains(const AkieGUI_Widget_T *widget) {
+    for (uint8_t i = 0; i < g_widget_list.count; i++) {
+        if (g_widget_list.widgets[i] == widget) return 1;
+    }
+    return 0;
+}
 
-    if (widget->x < dirty_min_x) dirty_min_x = widget->x;
-    if (widget->y < dirty_min_y) dirty_min_y = widget->y;
-    if (right   > dirty_max_x)   dirty_max_x = right;
-    if (bottom  > dirty_max_y)   dirty_max_y = bottom;
+/**
+  * @brief	标记控件脏，并把控件区域加入脏矩形列表
+  * @param	widget: 控件句柄
+  */
+void AkieGUI_Widget_MarkDirty(AkieGUI_Widget_T *widget) {
+    if (!widget) return;
+
+    widget->dirty = 1;
+    damage_add(widget->x, widget->y, widget->w, widget->h);
 }
 
 /**
-  * @brief	标记脏矩形，并扩展全局脏矩形
+  * @brief	把一块区域加入脏矩形列表
   * @param	x: X坐标
   * @param	y: Y坐标
   * @param	w: 宽度
@@ -129,16 +361,29 @@ void AkieGUI_Widget_MarkDirty(AkieGUI_Widget_T *widget) {
   */
 void AkieGUI_Widget_MarkRegionDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
     if (w == 0 || h == 0) return;
+    damage_add(x, y, w, h);
+}
 
-    // 扩展全局脏矩形
-    if (x < dirty_min_x) dirty_min_x = x;
-    if (y < dirty_min_y) dirty_min_y = y;
-    if (x + w > dirty_max_x) dirty_max_x = x + w;
-    if (y + h > dirty_max_y) dirty_max_y = y + h;
+/**
+  * @brief	把只设置了 dirty 标志的可见控件（如 SetValue/SetText 之后）加入脏矩形列表
+  * @note   加入后清掉标志，被完全挡住、不会被重画的控件也不会一直重复加入
+  * @retval	脏矩形个数
+  */
+uint8_t AkieGUI_Widget_CollectDirty(void) {
+    for (uint8_t i = 0; i < g_widget_list.count; i++) {
+        AkieGUI_Widget_T *w = g_widget_list.widgets[i];
+        if (w && w->dirty && (w->state & AKIEGUI_STATE_VISIBLE) && w->draw) {
+            damage_add(w->x, w->y, w->w, w->h);
+            w->dirty = 0;
+        }
+    }
+    return s_damage_count;
 }
 
 /**
-  * @brief	清除脏矩形
+  * @brief	从脏矩形列表中扣除一块区域
+  * @note   部分重叠的脏矩形拆成最多4块（上、下、左、右）；
+  *         列表放不下时按 damage_add 的规则合并，宁可多画也不漏画
   * @param	x: X坐标
   * @param	y: Y坐标
   * @param	w: 宽度
@@ -146,44 +391,200 @@ void AkieGUI_Widget_MarkRegionDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t
   */
 void AkieGUI_Widget_ClearDirtyRegion(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
     if (w == 0 || h == 0) return;
-    if (dirty_min_x > dirty_max_x) return;  // 无脏区域
-    safe_printf("\033[32m[LOG_I] Clear dirty region: [%d,%d %dx%d]\033[0m\r\n", x, y, w, h);
-    uint16_t clear_right = x + w;
-    uint16_t clear_bottom = y + h;
-
-    // 情况1：清除区域完全在脏矩形左侧
-    if (clear_right <= dirty_min_x) return;
-    // 情况2：清除区域完全在脏矩形右侧
-    if (x >= dirty_max_x) return;
-    // 情况3：清除区域完全在上方
-    if (clear_bottom <= dirty_min_y) return;
-    // 情况4：清除区域完全在下方
-    if (y >= dirty_max_y) return;
-
-    // 有重叠 → 缩小脏矩形（最简实现：清除整个脏矩形）
-    // 更精细的实现需要将脏矩形拆分成多个子矩形，但会增加复杂度。
-    // 对于你的使用场景（恢复背景后立即清除），直接重置脏矩形通常就够了。
-    if (x <= dirty_min_x && clear_right >= dirty_max_x &&
-        y <= dirty_min_y && clear_bottom >= dirty_max_y) {
-        // 清除区域完全覆盖脏矩形 → 直接清空
-        dirty_min_x = 0xFFFF;
-        dirty_min_y = 0xFFFF;
-        dirty_max_x = 0;
-        dirty_max_y = 0;
-    } else {
-        // 部分重叠：保守做法是不缩小，避免漏刷新。
-        // 如果你需要精确裁剪，需要实现矩形分割算法。
-        // 目前先不做复杂处理。
+    if (s_damage_count == 0) return;  // 无脏区域
+
+    const AkieGUI_Rect_T c = { x, y, w, h };
+    AkieGUI_Rect_T old[AkieGUI_DAMAGE_MAX];
+    uint8_t n = s_damage_count;
+    memcpy(old, s_damage, n * sizeof(AkieGUI_Rect_T));
+    s_damage_count = 0;
+
+    /* 剩下的部分重新加入列表：拆出来的小块被别的矩形包含时会被吸收 */
+    for (uint8_t i = 0; i < n; i++) {
+        AkieGUI_Rect_T piece[4];
+        uint8_t k = rect_subtract(&old[i], &c, piece);
+        for (uint8_t j = 0; j < k; j++) {
+            damage_add(piece[j].x, piece[j].y, piece[j].w, piece[j].h);
+        }
+    }
+}
+
+/**
+  * @brief	获取当前脏矩形列表
+  * @param	out: 输出数组
+  * @param	max: 数组容量
+  * @retval	脏矩形个数（可能大于 max，只复制前 max 个）
+  */
+uint8_t AkieGUI_Widget_GetDamage(AkieGUI_Rect_T *out, uint8_t max) {
+    if (out) {
+        uint8_t n = (s_damage_count < max) ? s_damage_count : max;
+        memcpy(out, s_damage, n * sizeof(AkieGUI_Rect_T));
+    }
+    return s_damage_count;
+}
+
+/**
+  * @brief	控件是否遮住自己的整个矩形
+  * @note   绘制透明度小于255时没有控件是不透明的
+*/
+static inline uint8_t widget_opaque(const AkieGUI_Widget_T *w) {
+    return (w->state & AKIEGUI_STATE_OPAQUE) && g_akiegui.draw_opa == AKIEGUI_OPA_COVER;
+}
+
+/**
+  * @brief	在区域裁剪下重画与之相交的控件（包括被脏控件覆盖的上下层控件）
+  * @note   先从上到下算出每个控件没被上层不透明控件挡住的部分：
+  *         完全挡住的跳过，部分挡住的裁剪到可见部分的包围盒；
+  *         有背景层时，把没有被任何不透明控件挡住的部分恢复成背景；
+  *         再按列表顺序从下到上绘制
+*/
+static void draw_widgets_in(void *fb, const AkieGUI_Rect_T *d) {
+    static AkieGUI_Rect_T s_clip[MAX_WIDGETS];      /* 每个控件的可见包围盒，w=0 为不画 */
+    AkieGUI_Rect_T vis[AkieGUI_OCCLUDE_MAX];        /* 还没被遮住的区域 */
+    uint8_t nvis = 1;
+    vis[0] = *d;
+
+    for (int i = g_widget_list.count - 1; i >= 0; i--) {
+        AkieGUI_Widget_T *w = g_widget_list.widgets[i];
+        s_clip[i].w = 0;
+        if (!(w->state & AKIEGUI_STATE_VISIBLE)) continue;
+
+        AkieGUI_Rect_T wr = { w->x, w->y, w->w, w->h };
+        if (!rect_overlap(&wr, d)) continue;
+        w->dirty = 0;
+        if (nvis == 0 || !w->draw) continue;
+
+        /* 可见部分 = 未遮住区域 ∩ 控件矩形，取包围盒 */
+        uint8_t any = 0;
+        for (uint8_t k = 0; k < nvis; k++) {
+            if (!rect_overlap(&vis[k], &wr)) continue;
+            uint16_t x0 = (vis[k].x > wr.x) ? vis[k].x : wr.x;
+            uint16_t y0 = (vis[k].y > wr.y) ? vis[k].y : wr.y;
+            uint16_t x1 = (vis[k].x + vis[k].w < wr.x + wr.w) ? vis[k].x + vis[k].w : wr.x + wr.w;
+            uint16_t y1 = (vis[k].y + vis[k].h < wr.y + wr.h) ? vis[k].y + vis[k].h : wr.y + wr.h;
+            AkieGUI_Rect_T part = { x0, y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0) };
+            if (any) {
+                rect_union(&s_clip[i], &part, &s_clip[i]);
+            } else {
+                s_clip[i] = part;
+                any = 1;
+            }
+        }
+        if (!any || !widget_opaque(w)) continue;
+
+        /* 不透明控件把它下面的区域挖掉；放不下拆出来的块时保留原块（多画不漏画）*/
+        AkieGUI_Rect_T next[AkieGUI_OCCLUDE_MAX];
+        uint8_t nnext = 0;
+        for (uint8_t k = 0; k < nvis; k++) {
+            AkieGUI_Rect_T piece[4];
+            uint8_t np = rect_subtract(&vis[k], &wr, piece);
+            if (nnext + np + (nvis - k - 1) > AkieGUI_OCCLUDE_MAX) {
+                next[nnext++] = vis[k];
+                continue;
+            }
+            for (uint8_t j = 0; j < np; j++) next[nnext++] = piece[j];
+        }
+        memcpy(vis, next, nnext * sizeof(AkieGUI_Rect_T));
+        nvis = nnext;
+    }
+
+    if (s_bg.mode != AKIEGUI_BG_NONE) {
+        for (uint8_t k = 0; k < nvis; k++) bg_restore(fb, &vis[k]);
+    }
+
+    for (int i = 0; i < g_widget_list.count; i++) {
+        if (s_clip[i].w == 0) continue;
+        AkieGUI_Widget_T *w = g_widget_list.widgets[i];
+        akiegui_clip_push(s_clip[i].x, s_clip[i].y, s_clip[i].w, s_clip[i].h);
+#if AkieGUI_DLIST_SIZE
+        if (s_dl_ready) {
+            akiegui_dl_replay(&s_dl, fb, s_dl_from[i], s_dl_to[i]);
+        } else
+#endif
+        {
+            /* 同一帧里控件可能按区域画多次，每次画完归还它的临时数据 */
+            uint32_t mark = AkieGUI_Arena_Mark();
+            w->draw(w, fb);
+            AkieGUI_Arena_Release(mark);
+        }
+        akiegui_clip_pop();
     }
 }
 
+#if AkieGUI_DLIST_SIZE
+/**
+  * @brief	把与脏矩形列表相交的控件各绘制一次，录成显示列表
+  * @retval	1录制完整 0缓冲区放不下
+*/
+static uint8_t record_damage(void) {
+    if (s_dl.buf == NULL) akiegui_dl_init(&s_dl, s_dl_buf, sizeof(s_dl_buf));
+
+    void *fb = AkieGUI_GetDrawFB();
+    akiegui_dl_begin(&s_dl);
+    for (uint8_t i = 0; i < g_widget_list.count; i++) {
+        AkieGUI_Widget_T *w = g_widget_list.widgets[i];
+        s_dl_from[i] = s_dl_to[i] = akiegui_dl_mark(&s_dl);
+        if (!(w->state & AKIEGUI_STATE_VISIBLE) || !w->draw) continue;
+
+        AkieGUI_Rect_T wr = { w->x, w->y, w->w, w->h };
+        uint8_t hit = 0;
+        for (uint8_t k = 0; k < s_damage_count && !hit; k++) {
+            hit = rect_overlap(&wr, &s_damage[k]);
+        }
+        if (!hit) continue;
+
+        /* 与直接绘制一样裁剪到控件自己的矩形 */
+        akiegui_clip_push(wr.x, wr.y, wr.w, wr.h);
+        w->draw(w, fb);
+        akiegui_clip_pop();
+        s_dl_to[i] = akiegui_dl_mark(&s_dl);
+        if (s_dl.overflow) break;
+    }
+    akiegui_dl_end();
+    return !s_dl.overflow;
+}
+#endif
+
+#if !AkieGUI_TILE_SIZE
+/**
+  * @brief	重画一块区域并提交
+  * @note   分段渲染时按条带逐段绘制、发送，两块条带缓冲交替，
+  *         绘制下一段时上一段还在传输；整屏缓冲时只有一段
+*/
+static void redraw_rect(const AkieGUI_Rect_T *d) {
+    uint16_t y = d->y;
+    uint16_t y1 = d->y + d->h;
+
+    while (y < y1) {
+        uint16_t h = AkieGUI_BandBegin(y, y1 - y);
+        if (h == 0) break;
+
+        AkieGUI_Rect_T band = { d->x, y, d->w, h };
+        draw_widgets_in(AkieGUI_GetDrawFB(), &band);
+        AkieGUI_BandCommit(d->x, d->w);
+        y += h;
+    }
+}
+#endif
+
 /**
   * @brief	绘制所有脏控件，并提交
 */
 void AkieGUI_Widget_DrawDirtyAll(void) {
+#if AkieGUI_BAND_LINES
+    /* 没有整屏缓冲：按脏控件的区域分段重画 */
+    for (uint8_t i = 0; i < g_widget_list.count; i++) {
+        AkieGUI_Widget_T *w = g_widget_list.widgets[i];
+        if (w && (w->state & AKIEGUI_STATE_VISIBLE) && w->dirty && w->draw) {
+            damage_add(w->x, w->y, w->w, w->h);
+        }
+    }
+    AkieGUI_Widget_RedrawDirtyRegion();
+#else
     void *fb = AkieGUI_GetDrawFB();
     uint8_t has_dirty = 0;
     
+    AkieGUI_Arena_Reset();         /* 新的一帧 */
     for (uint8_t i = 0; i < g_widget_list.count; i++) {
         AkieGUI_Widget_T *w = g_widget_list.widgets[i];
         if (w && (w->state & AKIEGUI_STATE_VISIBLE) && w->dirty && w->draw) {
@@ -195,60 +596,59 @@ void AkieGUI_Widget_DrawDirtyAll(void) {
     if (has_dirty) {
         AkieGUI_Commit();          /* 提交到屏幕 */
     }
+#endif
 }
 
 /**
   * @brief	强制重绘所有控件 (全屏刷新)
 */
 void AkieGUI_Widget_RedrawAll(void) {
-    void *fb = AkieGUI_GetDrawFB();
-    
-    for (uint8_t i = 0; i < g_widget_list.count; i++) {
-        AkieGUI_Widget_T *w = g_widget_list.widgets[i];
-        if (w && (w->state & AKIEGUI_STATE_VISIBLE) && w->draw) {
-            w->draw(w, fb);
-        }
-    }
-    
+#if AkieGUI_BAND_LINES
+    // 整屏作为唯一的脏矩形，逐条带重画
+    s_damage_count = 0;
+    damage_add(0, 0, g_akiegui.fb_width, g_akiegui.fb_height);
+    AkieGUI_Widget_RedrawDirtyRegion();
+#else
+    AkieGUI_Rect_T screen = { 0, 0, (uint16_t)g_akiegui.fb_width, (uint16_t)g_akiegui.fb_height };
+    AkieGUI_Arena_Reset();         /* 新的一帧 */
+    draw_widgets_in(AkieGUI_GetDrawFB(), &screen);
     AkieGUI_Commit();
+#endif
 }
 
 /**
-  * @brief	只重绘全局脏矩形区域
+  * @brief	只重绘脏矩形列表中的区域
+  * @note   每个脏矩形内，与之相交的控件都在裁剪区内重画，脏矩形之外的像素不会被改动
   */
 void AkieGUI_Widget_RedrawDirtyRegion(void) {
-    if (dirty_min_x > dirty_max_x) return;  // 无脏区域
-
-    // 只绘制与脏矩形相交的控件
-    for (int i = 0; i < g_widget_list.count; i++) {
-        AkieGUI_Widget_T *w = g_widget_list.widgets[i];
-        if (!(w->state & AKIEGUI_STATE_VISIBLE)) continue;
+    if (s_damage_count == 0) return;  // 无脏区域
+    AkieGUI_Arena_Reset();            // 新的一帧，上一帧的临时数据作废
 
-        // 简单相交判断
-        if (w->x + w->w <= dirty_min_x) continue;
-        if (w->y + w->h <= dirty_min_y) continue;
-        if (w->x >= dirty_max_x) continue;
-        if (w->y >= dirty_max_y) continue;
+#if AkieGUI_DLIST_SIZE
+    // 要分几块画时，控件只绘制一次，各块回放录好的命令
+    s_dl_ready = (s_damage_count > 1 || AkieGUI_BAND_LINES) && record_damage();
+#endif
 
-        if (w->dirty && w->draw) {
-            // w->draw(w, AkieGUI_GetDrawFB());
-            w->draw(w, AkieGUI_GetDrawFB());
-            AkieGUI_CommitRegion(w->x, w->y, w->w, w->h);
-            w->dirty = 0;
-        }
+#if AkieGUI_TILE_SIZE
+    // 先全部画完，再只提交内容真正变化的块
+    void *fb = AkieGUI_GetDrawFB();
+    for (uint8_t k = 0; k < s_damage_count; k++) {
+        const AkieGUI_Rect_T *d = &s_damage[k];
+        draw_widgets_in(fb, d);
+        AkieGUI_Tile_Invalidate(d->x, d->y, d->w, d->h);
     }
+    AkieGUI_Tile_Flush();
+#else
+    // 逐个重画并提交脏矩形（节省传输带宽）
+    for (uint8_t k = 0; k < s_damage_count; k++) {
+        redraw_rect(&s_damage[k]);
+    }
+#endif
 
-    // // 提交脏矩形到屏幕（节省传输带宽）
-    // uint16_t w = dirty_max_x - dirty_min_x;
-    // uint16_t h = dirty_max_y - dirty_min_y;
-
-    // if (w == 0 || h == 0) return;
-
-    // AkieGUI_CommitRegion(dirty_min_x, dirty_min_y, w, h);
-
-    // 重置脏矩形
-    dirty_min_x = 0xFFFF; dirty_min_y = 0xFFFF;
-    dirty_max_x = 0;      dirty_max_y = 0;
+#if AkieGUI_DLIST_SIZE
+    s_dl_ready = 0;
+#endif
+    s_damage_count = 0;
 }
 
 /**
@@ -277,20 +677,14 @@ AkieGUI_Widget_T* AkieGUI_Widget_HitTest(uint16_t x, uint16_t y) {
 */
 void AkieGUI_Widget_Move(AkieGUI_Widget_T *widget, uint16_t new_x, uint16_t new_y) {
     if (!widget) return;
+    if (widget->x == new_x && widget->y == new_y) return;
 
-    // // 记录旧区域
-    // uint16_t old_x = widget->x, old_y = widget->y;
-
-    // 恢复旧位置的背景
-    AkieGUI_RestoreBackgroundArea(widget->x, widget->y, widget->w, widget->h);
-    // 清除这块区域的脏标记，防止被覆盖
-    AkieGUI_Widget_ClearDirtyRegion(widget->x, widget->y, widget->w, widget->h);
+    // 旧位置和新位置都进脏矩形列表（重叠多时合并成一块），
+    // 下一次重绘在绘制缓冲里恢复背景、合成控件，一次提交
+    AkieGUI_Widget_MarkRegionDirty(widget->x, widget->y, widget->w, widget->h);
 
     // 更新坐标
     widget->x = new_x;
     widget->y = new_y;
-
-    // 标记旧区域也需要重绘
-    // AkieGUI_Widget_MarkRegionDirty(old_x, old_y, widget->w, widget->h);
     AkieGUI_Widget_MarkDirty(widget);
 }
\ No newline at end of file
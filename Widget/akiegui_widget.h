@@ -15,6 +15,37 @@
 #include "akiegui_core.h"
 #include "akiegui_color.h"
 
+/* 脏矩形列表容量 */
+#ifndef AkieGUI_DAMAGE_MAX
+#define AkieGUI_DAMAGE_MAX          8
+#endif
+
+/* 脏区域总面积超过屏幕的这个百分比时，改为整屏重绘 */
+#ifndef AkieGUI_DAMAGE_FULL_PERCENT
+#define AkieGUI_DAMAGE_FULL_PERCENT 70
+#endif
+
+/* 遮挡计算时未遮住区域最多拆成的矩形数 */
+#ifndef AkieGUI_OCCLUDE_MAX
+#define AkieGUI_OCCLUDE_MAX         16
+#endif
+
+/* 显示列表缓冲区字节数：0=关闭；N>0=一次重画要分几块区域（多个脏矩形、条带）时，
+ * 控件只绘制一次录成命令，各区域回放（放不下时仍逐区域调用控件绘制函数）*/
+#ifndef AkieGUI_DLIST_SIZE
+#define AkieGUI_DLIST_SIZE          0
+#endif
+
+/* 控件管理器最多管理的控件数（不超过255）*/
+#ifndef AkieGUI_WIDGET_MAX
+#define AkieGUI_WIDGET_MAX          20
+#endif
+
+/* 每种控件的对象池每次扩充的个数（见 akiegui_pool.h）*/
+#ifndef AkieGUI_WIDGET_POOL_CHUNK
+#define AkieGUI_WIDGET_POOL_CHUNK   4
+#endif
+
 /* 控件类型 */
 typedef enum {
     AKIEGUI_WIDGET_NONE = 0,
@@ -29,6 +60,14 @@ typedef enum {
 #define AKIEGUI_STATE_ENABLED      (1 << 1)
 #define AKIEGUI_STATE_PRESSED      (1 << 2)
 #define AKIEGUI_STATE_FOCUSED      (1 << 3)
+#define AKIEGUI_STATE_OPAQUE       (1 << 4)   /* 绘制时用不透明像素盖满整个矩形，下层被挡住的部分不画 */
+
+/* ARGB8888 颜色画出来是否不透明（只有32位色开启混合时 alpha 才生效）*/
+#if AkieGUI_LCD_BPP == 32 && AKIEGUI_ENABLE_BLEND
+#define AKIEGUI_COLOR_OPAQUE(argb)  ((((uint32_t)(argb)) >> 24) == 0xFF)
+#else
+#define AKIEGUI_COLOR_OPAQUE(argb)  1
+#endif
 
 /* 通用控件结构体 */
 typedef struct AkieGUI_Widget {
@@ -57,6 +96,9 @@ typedef struct AkieGUI_Widget {
     /* 绘制函数 */
     void (*draw)(struct AkieGUI_Widget *self, void *fb);
     
+    /* 释放函数（由创建函数设置，AkieGUI_Widget_Delete 调用）*/
+    void (*destroy)(struct AkieGUI_Widget *self);
+    
     /* 私有数据 */
     void *priv;
 } AkieGUI_Widget_T;
@@ -65,14 +107,22 @@ typedef struct AkieGUI_Widget {
 void AkieGUI_Widget_Init(void);
 void AkieGUI_Widget_Add(AkieGUI_Widget_T *widget);
 void AkieGUI_BackupBackground(void);
+void AkieGUI_BackupBackgroundArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void AkieGUI_SetBackgroundColor(akiegui_color_t color);
+void AkieGUI_FreeBackground(void);
+void AkieGUI_RestoreBackgroundArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
 void AkieGUI_Widget_Remove(AkieGUI_Widget_T *widget);
 void AkieGUI_Widget_RemoveAll(void);
+void AkieGUI_Widget_Delete(AkieGUI_Widget_T *widget);
+uint8_t AkieGUI_Widget_Contains(const AkieGUI_Widget_T *widget);
 void AkieGUI_Widget_DrawDirtyAll(void);
 void AkieGUI_Widget_RedrawAll(void);
 void AkieGUI_Widget_RedrawDirtyRegion(void);
 void AkieGUI_Widget_MarkDirty(AkieGUI_Widget_T *widget);
 void AkieGUI_Widget_MarkRegionDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+uint8_t AkieGUI_Widget_CollectDirty(void);
 void AkieGUI_Widget_ClearDirtyRegion(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+uint8_t AkieGUI_Widget_GetDamage(AkieGUI_Rect_T *out, uint8_t max);
 AkieGUI_Widget_T* AkieGUI_Widget_HitTest(uint16_t x, uint16_t y);
 void AkieGUI_Widget_Move(AkieGUI_Widget_T *widget, uint16_t new_x, uint16_t new_y);
 
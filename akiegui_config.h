@@ -33,11 +33,25 @@
 #define AKIEGUI_ENABLE_BLEND 0
 #endif
 
+/* ============= SIMD加速配置 ============= */
+/* 1=在支持SSE2/NEON的平台上使用向量指令填充，0=只用32/64位整字写入 */
+#ifndef AKIEGUI_ENABLE_SIMD
+#define AKIEGUI_ENABLE_SIMD 1
+#endif
+
 /* FreeRTOS 默认配置 */
 #ifndef AkieGUI_USE_FREERTOS
 #define AkieGUI_USE_FREERTOS 0
 #endif
 
+/* ============= 内存池分配算法配置（裸机内存池，FreeRTOS时不用）============= */
+#define AkieGUI_MEM_FIRST_FIT   0    /* 首次适应：代码小，分配耗时随空闲块数增长 */
+#define AkieGUI_MEM_TLSF        1    /* TLSF：分配/释放时间有上界，临界区短 */
+
+#ifndef AkieGUI_MEM_ALLOCATOR
+#define AkieGUI_MEM_ALLOCATOR   AkieGUI_MEM_FIRST_FIT
+#endif
+
 /* ============= TE模式配置 ============= */
 #define AkieGUI_KE_NO_TE     0        /* 不等待TE，发送完即继续 */
 #define AkieGUI_KE_TE_EN     1        /* 等待TE，任何传输完成通知 */
@@ -56,6 +70,44 @@
 #define AkieGUI_DOUBLE_BUFFER_MODE    AkieGUI_NO_DOUBLE_BUFFER
 #endif
 
+/* ============= 分段渲染配置 ============= */
+/* 0=整屏帧缓冲；N>0=只分配两块 N 行的条带缓冲，脏区域按条带逐段绘制、逐段发送
+ * （大屏配小RAM用，不能与双缓冲同时使用）*/
+#ifndef AkieGUI_BAND_LINES
+#define AkieGUI_BAND_LINES    0
+#endif
+
+#if AkieGUI_BAND_LINES && AkieGUI_DOUBLE_BUFFER_MODE
+#error "AkieGUI_BAND_LINES cannot be used with AkieGUI_DOUBLE_BUFFER_EN"
+#endif
+
+/* ============= 分块提交配置 ============= */
+/* 0=关闭；N>0=把帧缓冲分成 N×N 的块，重画后只提交内容真正变化的块（合并成矩形发送）*/
+#ifndef AkieGUI_TILE_SIZE
+#define AkieGUI_TILE_SIZE     0
+#endif
+
+/* 1=对每块算校验和，重画后像素不变的块不再发送；0=脏块全部发送 */
+#ifndef AkieGUI_TILE_HASH
+#define AkieGUI_TILE_HASH     1
+#endif
+
+#if AkieGUI_TILE_SIZE && AkieGUI_BAND_LINES
+#error "AkieGUI_TILE_SIZE needs a full framebuffer, cannot be used with AkieGUI_BAND_LINES"
+#endif
+
+/* ============= 帧调度配置 ============= */
+/* AkieGUI_Task() 最多按这个帧率重绘（时基来自 AkieGUI_Tick）；0=有变化就立即重绘 */
+#ifndef AkieGUI_TARGET_FPS
+#define AkieGUI_TARGET_FPS    60
+#endif
+
+/* ============= 帧临时内存配置 ============= */
+/* 绘制时临时数据的缓冲区字节数（见 akiegui_arena.h），每帧开始重画时清空 */
+#ifndef AkieGUI_ARENA_SIZE
+#define AkieGUI_ARENA_SIZE    512
+#endif
+
 /* ============= 显存位置配置 ============= */
 #define AkieGUI_MEM_INTERNAL    0    /* 内部RAM */
 #define AkieGUI_MEM_EXTERNAL    1    /* 外部SDRAM */
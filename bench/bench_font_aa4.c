@@ -0,0 +1,505 @@
+/* ============= bench_font_aa4.c ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 4位灰度测试字库（ASCII 8*16）
+ *
+ * 由 ascii_font_8x16 生成：点亮的像素为15，旁边的像素按相邻点亮像素的个数给一个较低的灰度，
+ * 不是真正的抗锯齿字形，只用来跑通、测量 2/4位灰度字模的绘制路径
+ * 取模格式：逐行式，每像素4位，高位在前，每行4字节，每字64字节
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#include "akiegui_font.h"
+
+static const uint8_t bench_font_8x16_aa4[] = {
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*" ",0*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x00,0x00,0x6F,0x60,0x00,
+0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x00,0x8F,0x80,0x00,0x00,0x6F,0x60,0x00,0x00,0x24,0x20,0x00,0x00,0x24,0x20,0x00,
+0x00,0x6F,0x60,0x00,0x00,0x6F,0x60,0x00,0x00,0x24,0x20,0x00,0x00,0x00,0x00,0x00,/*"!",1*/
+
+0x00,0x24,0x22,0x42,0x02,0x8F,0x68,0xF4,0x06,0xF9,0x8F,0x92,0x29,0xF8,0x9F,0x60,
+0x4F,0x86,0xF8,0x20,0x24,0x22,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*""",2*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x22,0x42,0x00,0x6F,0x66,0xF6,
+0x00,0x8F,0x88,0xF8,0x26,0x9F,0x99,0xF8,0x4F,0xFF,0xFF,0xF6,0x29,0xF9,0x9F,0x92,
+0x08,0xF8,0x8F,0x80,0x29,0xF9,0x9F,0x92,0x4F,0xFF,0xFF,0xF4,0x29,0xF9,0x9F,0x92,
+0x08,0xF8,0x8F,0x80,0x06,0xF6,0x6F,0x60,0x02,0x42,0x24,0x20,0x00,0x00,0x00,0x00,/*"#",3*/
+
+0x00,0x00,0x00,0x00,0x00,0x02,0x42,0x00,0x02,0x69,0xF9,0x20,0x28,0xFF,0xFF,0x82,
+0x6F,0x99,0xF9,0xF6,0x8F,0x88,0xF9,0xF6,0x6F,0x99,0xF9,0x42,0x28,0xFF,0xF9,0x20,
+0x02,0x69,0xFF,0x82,0x00,0x08,0xF9,0xF6,0x24,0x28,0xF9,0xF8,0x6F,0x68,0xF9,0xF8,
+0x6F,0x99,0xF9,0xF6,0x28,0xFF,0xFF,0x82,0x02,0x69,0xF9,0x20,0x00,0x06,0xF6,0x00,/*"$",4*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x24,0x20,0x8F,0x82,0x6F,0x60,
+0xF9,0xF8,0x9F,0x60,0xF9,0xF9,0xF9,0x20,0xF9,0xF9,0xF6,0x00,0xF9,0xFF,0x96,0x20,
+0x8F,0x9F,0x9F,0x82,0x26,0x9F,0xF9,0xF6,0x06,0xF9,0xF9,0xF8,0x29,0xF9,0xF9,0xF8,
+0x6F,0x98,0xF9,0xF6,0x6F,0x62,0x8F,0x82,0x24,0x20,0x24,0x20,0x00,0x00,0x00,0x00,/*"%",5*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x66,0x20,0x00,0x28,0xFF,0x82,0x00,
+0x6F,0x99,0xF6,0x00,0x8F,0x88,0xF8,0x00,0x8F,0x99,0xF6,0x00,0x8F,0x9F,0x99,0x62,
+0x9F,0xF9,0xFF,0xF4,0xF9,0xF9,0x9F,0x92,0xF9,0x9F,0x9F,0x60,0xF8,0x6F,0xF9,0x44,
+0xF9,0x99,0xF9,0x9F,0x8F,0xFF,0x9F,0xF8,0x26,0x86,0x46,0x62,0x00,0x00,0x00,0x00,/*"&",6*/
+
+0x26,0x62,0x00,0x00,0x4F,0xF6,0x00,0x00,0x29,0xF8,0x00,0x00,0x29,0xF6,0x00,0x00,
+0x4F,0x82,0x00,0x00,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"'",7*/
+
+0x00,0x00,0x02,0x42,0x00,0x00,0x28,0xF4,0x00,0x02,0x8F,0x82,0x00,0x06,0xF9,0x20,
+0x00,0x29,0xF6,0x00,0x00,0x6F,0x92,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x6F,0x92,0x00,0x00,0x29,0xF6,0x00,
+0x00,0x06,0xF9,0x20,0x00,0x02,0x8F,0x82,0x00,0x00,0x28,0xF4,0x00,0x00,0x02,0x42,/*"(",8*/
+
+0x24,0x20,0x00,0x00,0x4F,0x82,0x00,0x00,0x28,0xF8,0x20,0x00,0x02,0x9F,0x60,0x00,
+0x00,0x6F,0x92,0x00,0x00,0x29,0xF6,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,
+0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x29,0xF6,0x00,0x00,0x6F,0x92,0x00,
+0x02,0x9F,0x60,0x00,0x28,0xF8,0x20,0x00,0x4F,0x82,0x00,0x00,0x24,0x20,0x00,0x00,/*")",9*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x00,
+0x00,0x6F,0x60,0x00,0x66,0x9F,0x96,0x62,0xFF,0x9F,0x9F,0xF4,0x69,0xFF,0xF9,0x62,
+0x69,0xFF,0xF9,0x62,0xFF,0x9F,0x9F,0xF4,0x66,0x9F,0x96,0x62,0x00,0x6F,0x60,0x00,
+0x00,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"*",10*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x02,0x42,0x00,0x00,0x06,0xF6,0x00,0x00,0x08,0xF8,0x00,0x26,0x89,0xF9,0x86,
+0x4F,0xFF,0xFF,0xFF,0x26,0x89,0xF9,0x86,0x00,0x08,0xF8,0x00,0x00,0x06,0xF6,0x00,
+0x00,0x02,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"+",11*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x62,0x00,0x00,
+0x4F,0xF6,0x00,0x00,0x29,0xF8,0x00,0x00,0x29,0xF6,0x00,0x00,0x4F,0x82,0x00,0x00,/*",",12*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x88,0x88,0x62,
+0x4F,0xFF,0xFF,0xF4,0x26,0x88,0x88,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"-",13*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x62,0x00,0x00,
+0x6F,0xF6,0x00,0x00,0x6F,0xF6,0x00,0x00,0x26,0x62,0x00,0x00,0x00,0x00,0x00,0x00,/*".",14*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x42,0x00,0x00,0x28,0xF4,0x00,0x00,0x6F,0x92,
+0x00,0x00,0x8F,0x80,0x00,0x02,0x9F,0x60,0x00,0x06,0xF9,0x20,0x00,0x29,0xF6,0x00,
+0x00,0x6F,0x92,0x00,0x00,0x8F,0x80,0x00,0x02,0x9F,0x60,0x00,0x06,0xF9,0x20,0x00,
+0x29,0xF6,0x00,0x00,0x6F,0x92,0x00,0x00,0x6F,0x60,0x00,0x00,0x24,0x20,0x00,0x00,/*"/",15*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x62,0x00,0x02,0x8F,0xF8,0x20,
+0x28,0xF9,0x9F,0x82,0x6F,0x92,0x29,0xF6,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,
+0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x6F,0x92,0x29,0xF6,
+0x28,0xF9,0x9F,0x82,0x02,0x8F,0xF8,0x20,0x00,0x26,0x62,0x00,0x00,0x00,0x00,0x00,/*"0",16*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x42,0x00,0x02,0x69,0xF6,0x00,
+0x04,0xFF,0xF8,0x00,0x02,0x69,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,
+0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,
+0x02,0x69,0xF9,0x62,0x04,0xFF,0xFF,0xF4,0x02,0x68,0x88,0x62,0x00,0x00,0x00,0x00,/*"1",17*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x86,0x20,0x28,0xFF,0xFF,0x82,
+0x6F,0x98,0x89,0xF6,0x8F,0x80,0x08,0xF8,0x6F,0x60,0x08,0xF8,0x24,0x20,0x29,0xF6,
+0x00,0x02,0x8F,0x82,0x00,0x28,0xF8,0x20,0x02,0x8F,0x82,0x00,0x28,0xF8,0x22,0x42,
+0x6F,0x99,0x89,0xF6,0x6F,0xFF,0xFF,0xF6,0x26,0x88,0x88,0x62,0x00,0x00,0x00,0x00,/*"2",18*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x86,0x20,0x28,0xFF,0xFF,0x82,
+0x6F,0x98,0x89,0xF6,0x6F,0x60,0x08,0xF8,0x24,0x20,0x29,0xF6,0x00,0x26,0x9F,0x82,
+0x00,0x4F,0xF9,0x40,0x00,0x26,0x9F,0x82,0x24,0x20,0x29,0xF6,0x6F,0x60,0x08,0xF8,
+0x6F,0x98,0x89,0xF6,0x28,0xFF,0xFF,0x82,0x02,0x68,0x86,0x20,0x00,0x00,0x00,0x00,/*"3",19*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x00,0x02,0x9F,0x60,
+0x00,0x06,0xFF,0x80,0x00,0x29,0xFF,0x80,0x02,0x8F,0x9F,0x80,0x06,0xF9,0x9F,0x80,
+0x29,0xF6,0x8F,0x80,0x6F,0x99,0x9F,0x96,0x6F,0xFF,0xFF,0xFF,0x26,0x88,0x9F,0x96,
+0x00,0x26,0x9F,0x96,0x00,0x4F,0xFF,0xFF,0x00,0x26,0x88,0x86,0x00,0x00,0x00,0x00,/*"4",20*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x88,0x88,0x62,0x6F,0xFF,0xFF,0xF4,
+0x8F,0x98,0x88,0x62,0x8F,0x80,0x00,0x00,0x8F,0x98,0x62,0x00,0x8F,0xFF,0xF8,0x20,
+0x6F,0x98,0x9F,0x82,0x24,0x20,0x29,0xF6,0x24,0x20,0x08,0xF8,0x6F,0x60,0x29,0xF6,
+0x6F,0x98,0x9F,0x82,0x28,0xFF,0xF8,0x20,0x02,0x68,0x62,0x00,0x00,0x00,0x00,0x00,/*"5",21*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x62,0x00,0x02,0x8F,0xF8,0x20,
+0x28,0xF9,0x9F,0x40,0x6F,0x92,0x24,0x20,0x8F,0x96,0x86,0x20,0x8F,0x9F,0xFF,0x82,
+0x8F,0xF9,0x89,0xF6,0x8F,0x92,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x6F,0x92,0x08,0xF8,
+0x28,0xF9,0x89,0xF6,0x02,0x8F,0xFF,0x82,0x00,0x26,0x86,0x20,0x00,0x00,0x00,0x00,/*"6",22*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x88,0x88,0x62,0x6F,0xFF,0xFF,0xF6,
+0x6F,0x98,0x99,0xF6,0x24,0x20,0x6F,0x92,0x00,0x02,0x9F,0x60,0x00,0x06,0xF9,0x20,
+0x00,0x29,0xF6,0x00,0x00,0x6F,0x92,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x00,0x8F,0x80,0x00,0x00,0x6F,0x60,0x00,0x00,0x24,0x20,0x00,0x00,0x00,0x00,0x00,/*"7",23*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x86,0x20,0x28,0xFF,0xFF,0x82,
+0x6F,0x98,0x89,0xF6,0x8F,0x80,0x08,0xF8,0x6F,0x92,0x29,0xF6,0x28,0xF9,0x9F,0x82,
+0x04,0x9F,0xF9,0x40,0x28,0xF9,0x9F,0x82,0x6F,0x92,0x29,0xF6,0x8F,0x80,0x08,0xF8,
+0x6F,0x98,0x89,0xF6,0x28,0xFF,0xFF,0x82,0x02,0x68,0x86,0x20,0x00,0x00,0x00,0x00,/*"8",24*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x62,0x00,0x28,0xFF,0xF8,0x20,
+0x6F,0x98,0x9F,0x82,0x8F,0x80,0x29,0xF6,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x29,0xF8,
+0x6F,0x98,0x9F,0xF8,0x28,0xFF,0xF9,0xF8,0x02,0x68,0x69,0xF8,0x02,0x42,0x29,0xF6,
+0x04,0xF9,0x9F,0x82,0x02,0x8F,0xF8,0x20,0x00,0x26,0x62,0x00,0x00,0x00,0x00,0x00,/*"9",25*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x26,0x62,0x00,0x00,0x6F,0xF6,0x00,0x00,0x6F,0xF6,0x00,
+0x00,0x26,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x62,0x00,
+0x00,0x6F,0xF6,0x00,0x00,0x6F,0xF6,0x00,0x00,0x26,0x62,0x00,0x00,0x00,0x00,0x00,/*":",26*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x00,0x00,0x4F,0x40,0x00,
+0x00,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x24,0x20,0x00,0x00,0x6F,0x60,0x00,0x00,0x8F,0x80,0x00,0x00,0x6F,0x60,0x00,/*";",27*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x42,0x00,0x00,0x28,0xF4,
+0x00,0x02,0x8F,0x82,0x00,0x28,0xF8,0x20,0x02,0x8F,0x82,0x00,0x28,0xF8,0x20,0x00,
+0x4F,0x94,0x00,0x00,0x28,0xF8,0x20,0x00,0x02,0x8F,0x82,0x00,0x00,0x28,0xF8,0x20,
+0x00,0x02,0x8F,0x82,0x00,0x00,0x28,0xF4,0x00,0x00,0x02,0x42,0x00,0x00,0x00,0x00,/*"<",28*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x26,0x88,0x88,0x62,0x4F,0xFF,0xFF,0xF4,0x26,0x88,0x88,0x62,
+0x26,0x88,0x88,0x62,0x4F,0xFF,0xFF,0xF4,0x26,0x88,0x88,0x62,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"=",29*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x00,0x00,0x4F,0x82,0x00,0x00,
+0x28,0xF8,0x20,0x00,0x02,0x8F,0x82,0x00,0x00,0x28,0xF8,0x20,0x00,0x02,0x8F,0x82,
+0x00,0x00,0x49,0xF4,0x00,0x02,0x8F,0x82,0x00,0x28,0xF8,0x20,0x02,0x8F,0x82,0x00,
+0x28,0xF8,0x20,0x00,0x4F,0x82,0x00,0x00,0x24,0x20,0x00,0x00,0x00,0x00,0x00,0x00,/*">",30*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x86,0x20,0x28,0xFF,0xFF,0x82,
+0x6F,0x98,0x89,0xF6,0x8F,0x92,0x08,0xF8,0x6F,0xF4,0x29,0xF6,0x26,0x64,0x8F,0x82,
+0x00,0x06,0xF9,0x20,0x00,0x08,0xF8,0x00,0x00,0x06,0xF6,0x00,0x00,0x28,0x94,0x00,
+0x00,0x6F,0xF6,0x00,0x00,0x6F,0xF6,0x00,0x00,0x26,0x62,0x00,0x00,0x00,0x00,0x00,/*"?",31*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x62,0x00,0x28,0xFF,0xF8,0x20,
+0x6F,0x99,0x9F,0x82,0x9F,0x9F,0xF9,0xF6,0xF9,0xF9,0xF9,0xF8,0xF9,0xF9,0xF9,0xF8,
+0xF9,0xF9,0xF9,0xF8,0xF9,0xF9,0xF9,0xF8,0xF9,0xF9,0xF9,0xF6,0x9F,0x9F,0xFF,0x94,
+0x6F,0x99,0x99,0xF4,0x28,0xFF,0xFF,0x82,0x02,0x68,0x86,0x20,0x00,0x00,0x00,0x00,/*"@",32*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x00,0x00,0x6F,0x60,0x00,
+0x00,0x8F,0x92,0x00,0x02,0x9F,0xF6,0x00,0x06,0xF9,0xF8,0x00,0x08,0xF9,0xF9,0x20,
+0x08,0xF9,0x9F,0x60,0x29,0xFF,0xFF,0x80,0x6F,0x98,0x9F,0x92,0x8F,0x80,0x29,0xF6,
+0x9F,0x92,0x29,0xF9,0xFF,0xF4,0x4F,0xFF,0x68,0x62,0x26,0x86,0x00,0x00,0x00,0x00,/*"A",33*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x88,0x62,0x00,0xFF,0xFF,0xF8,0x20,
+0x9F,0x98,0x9F,0x60,0x8F,0x80,0x8F,0x80,0x8F,0x98,0x9F,0x60,0x8F,0xFF,0xF9,0x40,
+0x8F,0x98,0x9F,0x82,0x8F,0x80,0x29,0xF6,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x29,0xF6,
+0x9F,0x98,0x9F,0x82,0xFF,0xFF,0xF8,0x20,0x68,0x88,0x62,0x00,0x00,0x00,0x00,0x00,/*"B",34*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x88,0x62,0x28,0xFF,0xFF,0xF6,
+0x6F,0x98,0x89,0xF8,0x9F,0x60,0x06,0xF6,0xF9,0x20,0x02,0x42,0xF8,0x00,0x00,0x00,
+0xF8,0x00,0x00,0x00,0xF8,0x00,0x00,0x00,0xF9,0x20,0x02,0x42,0x9F,0x60,0x28,0xF4,
+0x6F,0x98,0x9F,0x82,0x28,0xFF,0xF8,0x20,0x02,0x68,0x62,0x00,0x00,0x00,0x00,0x00,/*"C",35*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x88,0x62,0x00,0xFF,0xFF,0xF8,0x20,
+0x9F,0x98,0x9F,0x82,0x8F,0x80,0x29,0xF6,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,
+0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x29,0xF6,
+0x9F,0x98,0x9F,0x82,0xFF,0xFF,0xF8,0x20,0x68,0x88,0x62,0x00,0x00,0x00,0x00,0x00,/*"D",36*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x88,0x86,0x20,0xFF,0xFF,0xFF,0x82,
+0x9F,0x99,0x99,0xF4,0x8F,0x86,0xF8,0x42,0x8F,0x99,0xF8,0x00,0x8F,0xFF,0xF8,0x00,
+0x8F,0x99,0xF8,0x00,0x8F,0x86,0xF6,0x00,0x8F,0x82,0x44,0x42,0x8F,0x80,0x06,0xF6,
+0x9F,0x98,0x89,0xF6,0xFF,0xFF,0xFF,0x82,0x68,0x88,0x86,0x20,0x00,0x00,0x00,0x00,/*"E",37*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x88,0x86,0x20,0xFF,0xFF,0xFF,0x82,
+0x9F,0x99,0x99,0xF4,0x8F,0x86,0xF8,0x42,0x8F,0x99,0xF8,0x00,0x8F,0xFF,0xF8,0x00,
+0x8F,0x99,0xF8,0x00,0x8F,0x86,0xF6,0x00,0x8F,0x82,0x42,0x00,0x8F,0x80,0x00,0x00,
+0x9F,0x92,0x00,0x00,0xFF,0xF4,0x00,0x00,0x68,0x62,0x00,0x00,0x00,0x00,0x00,0x00,/*"F",38*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x86,0x20,0x28,0xFF,0xFF,0x60,
+0x6F,0x98,0x9F,0x80,0x9F,0x60,0x6F,0x60,0xF9,0x20,0x24,0x20,0xF8,0x00,0x00,0x00,
+0xF8,0x02,0x68,0x62,0xF8,0x04,0xFF,0xF4,0xF9,0x22,0x9F,0x92,0x9F,0x60,0x8F,0x80,
+0x6F,0x98,0x9F,0x60,0x28,0xFF,0xF8,0x20,0x02,0x68,0x62,0x00,0x00,0x00,0x00,0x00,/*"G",39*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x62,0x26,0x86,0xFF,0xF4,0x4F,0xFF,
+0x9F,0x92,0x29,0xF9,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x98,0x89,0xF8,
+0x8F,0xFF,0xFF,0xF8,0x8F,0x98,0x89,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,
+0x9F,0x92,0x29,0xF9,0xFF,0xF4,0x4F,0xFF,0x68,0x62,0x26,0x86,0x00,0x00,0x00,0x00,/*"H",40*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x88,0x86,0x20,0x4F,0xFF,0xFF,0x40,
+0x26,0x9F,0x96,0x20,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x26,0x9F,0x96,0x20,0x4F,0xFF,0xFF,0x40,0x26,0x88,0x86,0x20,0x00,0x00,0x00,0x00,/*"I",41*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x88,0x62,0x04,0xFF,0xFF,0xF4,
+0x02,0x69,0xF9,0x62,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,
+0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,
+0x00,0x08,0xF8,0x00,0x42,0x08,0xF8,0x00,0xF9,0x89,0xF6,0x00,0xFF,0xFF,0x82,0x00,/*"J",42*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x64,0x68,0x62,0xFF,0xF8,0xFF,0xF4,
+0x9F,0x96,0x9F,0x92,0x8F,0x98,0xF8,0x20,0x8F,0x9F,0x92,0x00,0x8F,0xFF,0x80,0x00,
+0x8F,0x9F,0x92,0x00,0x8F,0x99,0xF6,0x00,0x8F,0x86,0xF9,0x20,0x8F,0x82,0x9F,0x60,
+0x9F,0x94,0x9F,0x92,0xFF,0xF8,0xFF,0xF4,0x68,0x64,0x68,0x62,0x00,0x00,0x00,0x00,/*"K",43*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x62,0x00,0x00,0xFF,0xF4,0x00,0x00,
+0x9F,0x92,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,
+0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x02,0x42,
+0x9F,0x98,0x89,0xF6,0xFF,0xFF,0xFF,0xF6,0x68,0x88,0x88,0x62,0x00,0x00,0x00,0x00,/*"L",44*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x64,0x68,0x62,0xFF,0xF9,0xFF,0xF4,
+0x9F,0xF9,0xFF,0x92,0x8F,0xF9,0xFF,0x80,0x8F,0xF9,0xFF,0x80,0x8F,0xF9,0xFF,0x80,
+0x8F,0xF9,0xFF,0x80,0x8F,0x9F,0x9F,0x80,0x8F,0x9F,0x9F,0x80,0x8F,0x9F,0x9F,0x80,
+0x9F,0x9F,0x9F,0x92,0xFF,0x9F,0x9F,0xF4,0x66,0x44,0x46,0x62,0x00,0x00,0x00,0x00,/*"M",45*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x20,0x26,0x86,0xFF,0x92,0x4F,0xFF,
+0x9F,0xF6,0x29,0xF9,0x8F,0xF9,0x28,0xF8,0x8F,0x9F,0x68,0xF8,0x8F,0x9F,0x99,0xF8,
+0x8F,0x99,0xF9,0xF8,0x8F,0x88,0xF9,0xF8,0x8F,0x86,0xF9,0xF8,0x8F,0x82,0x9F,0xF8,
+0x9F,0x92,0x6F,0xF8,0xFF,0xF4,0x29,0xF6,0x68,0x62,0x02,0x42,0x00,0x00,0x00,0x00,/*"N",46*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x62,0x00,0x28,0xFF,0xF8,0x20,
+0x8F,0x98,0x9F,0x82,0xF9,0x20,0x29,0xF6,0xF8,0x00,0x08,0xF8,0xF8,0x00,0x08,0xF8,
+0xF8,0x00,0x08,0xF8,0xF8,0x00,0x08,0xF8,0xF8,0x00,0x08,0xF8,0xF9,0x20,0x29,0xF6,
+0x8F,0x98,0x9F,0x82,0x28,0xFF,0xF8,0x20,0x02,0x68,0x62,0x00,0x00,0x00,0x00,0x00,/*"O",47*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x88,0x86,0x20,0xFF,0xFF,0xFF,0x82,
+0x9F,0x98,0x89,0xF6,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x98,0x89,0xF6,
+0x8F,0xFF,0xFF,0x82,0x8F,0x98,0x86,0x20,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,
+0x9F,0x92,0x00,0x00,0xFF,0xF4,0x00,0x00,0x68,0x62,0x00,0x00,0x00,0x00,0x00,0x00,/*"P",48*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x62,0x00,0x28,0xFF,0xF8,0x20,
+0x8F,0x98,0x9F,0x82,0xF9,0x20,0x29,0xF6,0xF8,0x00,0x08,0xF8,0xF8,0x00,0x08,0xF8,
+0xF8,0x00,0x08,0xF8,0xF8,0x00,0x08,0xF8,0xF9,0x66,0x28,0xF8,0xF9,0xFF,0x99,0xF6,
+0x8F,0x99,0xFF,0x82,0x28,0xFF,0xF9,0x82,0x02,0x68,0x9F,0xF4,0x00,0x00,0x26,0x62,/*"Q",49*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x88,0x86,0x20,0xFF,0xFF,0xFF,0x82,
+0x9F,0x98,0x89,0xF6,0x8F,0x80,0x08,0xF8,0x8F,0x98,0x89,0xF6,0x8F,0xFF,0xFF,0x82,
+0x8F,0x99,0xF9,0x20,0x8F,0x86,0xF9,0x20,0x8F,0x82,0x9F,0x60,0x8F,0x80,0x6F,0x92,
+0x9F,0x92,0x29,0xF9,0xFF,0xF4,0x06,0xFF,0x68,0x62,0x02,0x66,0x00,0x00,0x00,0x00,/*"R",50*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x88,0x62,0x28,0xFF,0xFF,0xF6,
+0x6F,0x98,0x89,0xF8,0x8F,0x80,0x06,0xF6,0x6F,0x92,0x02,0x42,0x28,0xF9,0x62,0x00,
+0x02,0x8F,0xF8,0x20,0x00,0x26,0x9F,0x82,0x24,0x20,0x29,0xF6,0x6F,0x60,0x08,0xF8,
+0x8F,0x98,0x89,0xF6,0x6F,0xFF,0xFF,0x82,0x26,0x88,0x86,0x20,0x00,0x00,0x00,0x00,/*"S",51*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x88,0x88,0x62,0xFF,0xFF,0xFF,0xF6,
+0xF9,0x9F,0x99,0xF6,0x42,0x8F,0x82,0x42,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x02,0x9F,0x92,0x00,0x04,0xFF,0xF4,0x00,0x02,0x68,0x62,0x00,0x00,0x00,0x00,0x00,/*"T",52*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x62,0x26,0x86,0xFF,0xF4,0x4F,0xFF,
+0x9F,0x92,0x29,0xF9,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,
+0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,
+0x6F,0x98,0x89,0xF6,0x28,0xFF,0xFF,0x82,0x02,0x68,0x86,0x20,0x00,0x00,0x00,0x00,/*"U",53*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x62,0x26,0x86,0xFF,0xF4,0x4F,0xFF,
+0x9F,0x92,0x29,0xF9,0x8F,0x80,0x29,0xF6,0x6F,0x92,0x6F,0x92,0x29,0xF6,0x8F,0x80,
+0x08,0xF9,0x9F,0x60,0x08,0xF9,0xF9,0x20,0x06,0xF9,0xF8,0x00,0x02,0x9F,0xF6,0x00,
+0x00,0x8F,0x92,0x00,0x00,0x6F,0x60,0x00,0x00,0x24,0x20,0x00,0x00,0x00,0x00,0x00,/*"V",54*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x44,0x46,0x62,0xFF,0x9F,0x9F,0xF4,
+0x9F,0x9F,0x9F,0x92,0x8F,0x9F,0x9F,0x80,0x8F,0x9F,0x9F,0x80,0x8F,0x9F,0x9F,0x80,
+0x8F,0x9F,0x9F,0x80,0x6F,0xF9,0xFF,0x60,0x29,0xF9,0xF9,0x20,0x08,0xF9,0xF8,0x00,
+0x08,0xF9,0xF8,0x00,0x06,0xF9,0xF6,0x00,0x02,0x44,0x42,0x00,0x00,0x00,0x00,0x00,/*"W",55*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x62,0x26,0x86,0xFF,0xF4,0x4F,0xFF,
+0x9F,0x94,0x49,0xF9,0x29,0xF6,0x6F,0x92,0x06,0xF9,0x9F,0x60,0x02,0x9F,0xF9,0x20,
+0x00,0x8F,0xF8,0x00,0x02,0x9F,0xF9,0x20,0x06,0xF9,0x9F,0x60,0x29,0xF6,0x6F,0x92,
+0x9F,0x94,0x49,0xF9,0xFF,0xF4,0x4F,0xFF,0x68,0x62,0x26,0x86,0x00,0x00,0x00,0x00,/*"X",56*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x64,0x68,0x62,0xFF,0xF8,0xFF,0xF4,
+0x9F,0x94,0x9F,0x92,0x6F,0x94,0x9F,0x60,0x29,0xF9,0xF9,0x20,0x06,0xF9,0xF6,0x00,
+0x02,0x9F,0x92,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x02,0x9F,0x92,0x00,0x04,0xFF,0xF4,0x00,0x02,0x68,0x62,0x00,0x00,0x00,0x00,0x00,/*"Y",57*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x88,0x88,0x62,0x8F,0xFF,0xFF,0xF4,
+0xF9,0x88,0x9F,0x92,0x42,0x02,0x9F,0x60,0x00,0x06,0xF9,0x20,0x00,0x29,0xF6,0x00,
+0x02,0x8F,0x82,0x00,0x06,0xF9,0x20,0x00,0x29,0xF6,0x02,0x42,0x6F,0x92,0x06,0xF6,
+0x9F,0x98,0x89,0xF6,0xFF,0xFF,0xFF,0x82,0x68,0x88,0x86,0x20,0x00,0x00,0x00,0x00,/*"Z",58*/
+
+0x00,0x26,0x88,0x62,0x00,0x6F,0xFF,0xF4,0x00,0x8F,0x98,0x62,0x00,0x8F,0x80,0x00,
+0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x00,0x8F,0x80,0x00,0x00,0x8F,0x98,0x62,0x00,0x6F,0xFF,0xF4,0x00,0x26,0x88,0x62,/*"[",59*/
+
+0x00,0x00,0x00,0x00,0x24,0x20,0x00,0x00,0x4F,0x82,0x00,0x00,0x29,0xF6,0x00,0x00,
+0x08,0xF8,0x00,0x00,0x06,0xF9,0x20,0x00,0x02,0x9F,0x60,0x00,0x00,0x8F,0x80,0x00,
+0x00,0x6F,0x92,0x00,0x00,0x29,0xF6,0x00,0x00,0x06,0xF9,0x20,0x00,0x02,0x9F,0x60,
+0x00,0x00,0x8F,0x80,0x00,0x00,0x6F,0x92,0x00,0x00,0x29,0xF6,0x00,0x00,0x06,0xF6,/*"\",60*/
+
+0x26,0x88,0x62,0x00,0x4F,0xFF,0xF6,0x00,0x26,0x89,0xF8,0x00,0x00,0x08,0xF8,0x00,
+0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,
+0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,
+0x00,0x08,0xF8,0x00,0x26,0x89,0xF8,0x00,0x4F,0xFF,0xF6,0x00,0x26,0x88,0x62,0x00,/*"]",61*/
+
+0x00,0x26,0x62,0x00,0x02,0x8F,0xF8,0x20,0x04,0xF9,0x9F,0x40,0x02,0x42,0x24,0x20,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"^",62*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x88,0x88,0x86,0xFF,0xFF,0xFF,0xFF,/*"_",63*/
+
+0x26,0x62,0x00,0x00,0x4F,0xF8,0x20,0x00,0x26,0x9F,0x40,0x00,0x00,0x24,0x20,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"`",64*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x62,0x00,0x28,0xFF,0xF8,0x20,
+0x4F,0x99,0x9F,0x60,0x26,0x89,0xFF,0x80,0x28,0xFF,0x9F,0x80,0x6F,0x98,0x9F,0x80,
+0x6F,0x99,0xFF,0x92,0x28,0xFF,0x9F,0xF4,0x02,0x66,0x46,0x62,0x00,0x00,0x00,0x00,/*"a",65*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x20,0x00,0x00,
+0xFF,0x60,0x00,0x00,0x9F,0x80,0x00,0x00,0x8F,0x96,0x62,0x00,0x8F,0x9F,0xF8,0x20,
+0x8F,0xF9,0x9F,0x82,0x8F,0x92,0x29,0xF6,0x8F,0x80,0x08,0xF8,0x8F,0x92,0x29,0xF6,
+0x8F,0xF9,0x9F,0x82,0x6F,0x9F,0xF8,0x20,0x24,0x46,0x62,0x00,0x00,0x00,0x00,0x00,/*"b",66*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x86,0x20,0x02,0x8F,0xFF,0x82,
+0x28,0xF9,0x89,0xF4,0x6F,0x92,0x02,0x42,0x8F,0x80,0x00,0x00,0x6F,0x92,0x02,0x42,
+0x28,0xF9,0x89,0xF4,0x02,0x8F,0xFF,0x82,0x00,0x26,0x86,0x20,0x00,0x00,0x00,0x00,/*"c",67*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x62,
+0x00,0x00,0x4F,0xF6,0x00,0x00,0x29,0xF8,0x02,0x68,0x89,0xF8,0x28,0xFF,0xFF,0xF8,
+0x6F,0x98,0x89,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x29,0xF8,
+0x6F,0x98,0x9F,0xF9,0x28,0xFF,0xF9,0xFF,0x02,0x68,0x64,0x66,0x00,0x00,0x00,0x00,/*"d",68*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x86,0x20,0x28,0xFF,0xFF,0x82,
+0x6F,0x98,0x89,0xF6,0x8F,0x98,0x89,0xF8,0x8F,0xFF,0xFF,0xF6,0x8F,0x98,0x89,0x94,
+0x6F,0x98,0x89,0xF4,0x28,0xFF,0xFF,0x82,0x02,0x68,0x86,0x20,0x00,0x00,0x00,0x00,/*"e",69*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x66,0x20,
+0x00,0x28,0xFF,0x82,0x00,0x6F,0x99,0xF4,0x26,0x9F,0x98,0x62,0x4F,0xFF,0xFF,0x40,
+0x26,0x9F,0x96,0x20,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x26,0x9F,0x96,0x20,0x4F,0xFF,0xFF,0x40,0x26,0x88,0x86,0x20,0x00,0x00,0x00,0x00,/*"f",70*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x88,0x62,0x28,0xFF,0xFF,0xF4,
+0x6F,0x98,0x9F,0x92,0x6F,0x98,0x9F,0x60,0x49,0xFF,0xF8,0x20,0x4F,0x99,0x98,0x20,
+0x49,0xFF,0xFF,0x82,0x6F,0x98,0x89,0xF6,0x6F,0x98,0x89,0xF6,0x28,0xFF,0xFF,0x82,/*"g",71*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x20,0x00,0x00,
+0xFF,0x60,0x00,0x00,0x9F,0x80,0x00,0x00,0x8F,0x96,0x86,0x20,0x8F,0x9F,0xFF,0x82,
+0x8F,0xF9,0x89,0xF6,0x8F,0x92,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,
+0x9F,0x92,0x29,0xF9,0xFF,0xF4,0x4F,0xFF,0x68,0x62,0x26,0x86,0x00,0x00,0x00,0x00,/*"h",72*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x66,0x20,0x00,0x06,0xFF,0x60,0x00,
+0x06,0xFF,0x60,0x00,0x02,0x66,0x20,0x00,0x26,0x86,0x20,0x00,0x4F,0xFF,0x60,0x00,
+0x26,0x9F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x26,0x9F,0x96,0x20,0x4F,0xFF,0xFF,0x40,0x26,0x88,0x86,0x20,0x00,0x00,0x00,0x00,/*"i",73*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x66,0x20,0x00,0x06,0xFF,0x60,
+0x00,0x06,0xFF,0x60,0x00,0x02,0x66,0x20,0x00,0x26,0x86,0x20,0x00,0x4F,0xFF,0x60,
+0x00,0x26,0x9F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,
+0x00,0x00,0x8F,0x80,0x24,0x20,0x8F,0x80,0x6F,0x98,0x9F,0x60,0x6F,0xFF,0xF8,0x20,/*"j",74*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x20,0x00,0x00,
+0xFF,0x60,0x00,0x00,0x9F,0x80,0x00,0x00,0x8F,0x82,0x68,0x62,0x8F,0x86,0xFF,0xF4,
+0x8F,0x99,0xF9,0x62,0x8F,0x9F,0x92,0x00,0x8F,0xFF,0x92,0x00,0x8F,0x99,0xF8,0x20,
+0x9F,0x96,0x9F,0x92,0xFF,0xF8,0xFF,0xF4,0x68,0x64,0x68,0x62,0x00,0x00,0x00,0x00,/*"k",75*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x20,0x00,0x26,0x9F,0x60,0x00,
+0x4F,0xFF,0x80,0x00,0x26,0x9F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,
+0x26,0x9F,0x96,0x20,0x4F,0xFF,0xFF,0x40,0x26,0x88,0x86,0x20,0x00,0x00,0x00,0x00,/*"l",76*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x88,0x88,0x62,0xFF,0xFF,0xFF,0xF8,
+0x9F,0x99,0xF9,0x9F,0x8F,0x88,0xF8,0x8F,0x8F,0x88,0xF8,0x8F,0x8F,0x88,0xF8,0x8F,
+0x9F,0x99,0xF9,0x9F,0xFF,0xF9,0xFF,0x9F,0x68,0x64,0x66,0x44,0x00,0x00,0x00,0x00,/*"m",77*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x46,0x86,0x20,0xFF,0x9F,0xFF,0x82,
+0x9F,0xF9,0x89,0xF6,0x8F,0x92,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,
+0x9F,0x92,0x29,0xF9,0xFF,0xF4,0x4F,0xFF,0x68,0x62,0x26,0x86,0x00,0x00,0x00,0x00,/*"n",78*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x86,0x20,0x28,0xFF,0xFF,0x82,
+0x6F,0x98,0x89,0xF6,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,
+0x6F,0x98,0x89,0xF6,0x28,0xFF,0xFF,0x82,0x02,0x68,0x86,0x20,0x00,0x00,0x00,0x00,/*"o",79*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x46,0x62,0x00,0xFF,0x9F,0xF8,0x20,
+0x9F,0xF9,0x9F,0x82,0x8F,0x92,0x29,0xF6,0x8F,0x80,0x08,0xF8,0x8F,0x92,0x29,0xF6,
+0x8F,0xF9,0x9F,0x82,0x8F,0x9F,0xF8,0x20,0x9F,0x98,0x62,0x00,0xFF,0xF4,0x00,0x00,/*"p",80*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x64,0x42,0x02,0x8F,0xF9,0xF6,
+0x28,0xF9,0x9F,0xF8,0x6F,0x92,0x29,0xF8,0x8F,0x80,0x08,0xF8,0x6F,0x92,0x29,0xF8,
+0x28,0xF9,0x9F,0xF8,0x02,0x8F,0xF9,0xF8,0x00,0x26,0x89,0xF9,0x00,0x00,0x4F,0xFF,/*"q",81*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x64,0x68,0x62,0xFF,0xF9,0xFF,0xF6,
+0x69,0xFF,0x99,0xF6,0x08,0xF9,0x22,0x42,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,
+0x69,0xF9,0x62,0x00,0xFF,0xFF,0xF4,0x00,0x68,0x88,0x62,0x00,0x00,0x00,0x00,0x00,/*"r",82*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x68,0x88,0x62,0x28,0xFF,0xFF,0xF6,
+0x6F,0x98,0x89,0xF6,0x6F,0x98,0x88,0x62,0x28,0xFF,0xFF,0x82,0x26,0x88,0x89,0xF6,
+0x6F,0x98,0x89,0xF6,0x6F,0xFF,0xFF,0x82,0x26,0x88,0x86,0x20,0x00,0x00,0x00,0x00,/*"s",83*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x24,0x20,0x00,0x00,0x6F,0x60,0x00,0x26,0x9F,0x96,0x20,0x4F,0xFF,0xFF,0x40,
+0x26,0x9F,0x96,0x20,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x82,0x42,
+0x00,0x6F,0x99,0xF4,0x00,0x28,0xFF,0x82,0x00,0x02,0x66,0x20,0x00,0x00,0x00,0x00,/*"t",84*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x20,0x26,0x62,0xFF,0x60,0x4F,0xF6,
+0x9F,0x80,0x29,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x08,0xF8,0x8F,0x80,0x29,0xF8,
+0x6F,0x98,0x9F,0xF9,0x28,0xFF,0xF9,0xFF,0x02,0x68,0x64,0x66,0x00,0x00,0x00,0x00,/*"u",85*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x64,0x68,0x62,0xFF,0xF8,0xFF,0xF4,
+0x9F,0x94,0x9F,0x92,0x6F,0x94,0x9F,0x60,0x29,0xF9,0xF9,0x20,0x06,0xF9,0xF6,0x00,
+0x02,0x9F,0x92,0x00,0x00,0x6F,0x60,0x00,0x00,0x24,0x20,0x00,0x00,0x00,0x00,0x00,/*"v",86*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0x46,0x64,0x66,0xFF,0x8F,0xF9,0xFF,
+0xF9,0x69,0xF9,0x9F,0x9F,0x89,0xF9,0xF9,0x8F,0x9F,0xF9,0xF6,0x6F,0x9F,0x9F,0x92,
+0x29,0xF9,0x9F,0x80,0x06,0xF6,0x6F,0x60,0x02,0x42,0x24,0x20,0x00,0x00,0x00,0x00,/*"w",87*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x86,0x46,0x62,0x4F,0xFF,0x9F,0xF4,
+0x29,0xF9,0x9F,0x92,0x02,0x9F,0xF9,0x20,0x00,0x8F,0xF8,0x00,0x02,0x9F,0xF9,0x20,
+0x29,0xF9,0x9F,0x92,0x4F,0xF9,0xFF,0xF4,0x26,0x64,0x68,0x62,0x00,0x00,0x00,0x00,/*"x",88*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0x62,0x26,0x86,0xFF,0xF4,0x4F,0xFF,
+0x9F,0x94,0x49,0xF9,0x29,0xF6,0x6F,0x92,0x06,0xF9,0x9F,0x60,0x02,0x9F,0xF9,0x20,
+0x00,0x8F,0xF6,0x00,0x00,0x8F,0x92,0x00,0x26,0x9F,0x60,0x00,0x4F,0xF8,0x20,0x00,/*"y",89*/
+
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x88,0x88,0x62,0x6F,0xFF,0xFF,0xF4,
+0x6F,0x99,0x9F,0x92,0x24,0x48,0xF8,0x20,0x00,0x6F,0x92,0x00,0x02,0x9F,0x62,0x42,
+0x29,0xF9,0x99,0xF6,0x4F,0xFF,0xFF,0xF6,0x26,0x88,0x88,0x62,0x00,0x00,0x00,0x00,/*"z",90*/
+
+0x00,0x00,0x02,0x66,0x00,0x00,0x28,0xFF,0x00,0x00,0x6F,0x96,0x00,0x00,0x8F,0x80,
+0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,0x00,0x02,0x9F,0x60,
+0x00,0x04,0xF9,0x40,0x00,0x02,0x9F,0x60,0x00,0x00,0x8F,0x80,0x00,0x00,0x8F,0x80,
+0x00,0x00,0x8F,0x80,0x00,0x00,0x6F,0x96,0x00,0x00,0x28,0xFF,0x00,0x00,0x02,0x66,/*"{",91*/
+
+0x00,0x06,0xF6,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,
+0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,
+0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,
+0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x06,0xF6,0x00,/*"|",92*/
+
+0x66,0x20,0x00,0x00,0xFF,0x82,0x00,0x00,0x69,0xF6,0x00,0x00,0x08,0xF8,0x00,0x00,
+0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,0x06,0xF9,0x20,0x00,
+0x04,0x9F,0x40,0x00,0x06,0xF9,0x20,0x00,0x08,0xF8,0x00,0x00,0x08,0xF8,0x00,0x00,
+0x08,0xF8,0x00,0x00,0x69,0xF6,0x00,0x00,0xFF,0x82,0x00,0x00,0x66,0x20,0x00,0x00,/*"}",93*/
+
+0x28,0xF9,0x64,0x42,0x4F,0x9F,0xF9,0xF4,0x24,0x46,0x9F,0x82,0x00,0x00,0x24,0x20,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,/*"~",94*/
+};
+
+pFONT Bench_ASCII_8x16_AA4 = {
+  bench_font_8x16_aa4,
+  8,
+  16,
+  64,
+  0,
+  FONT_TYPE_ASCII,
+  NULL,
+  0,
+  4
+};
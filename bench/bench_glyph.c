@@ -0,0 +1,92 @@
+/* ============= bench_glyph.c ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 字模绘制耗时测试：1位点阵 vs 4位灰度
+ *
+ * 同一段文字分别用 ASCII_8x16（1位）和 Bench_ASCII_8x16_AA4（4位，见 bench_font_aa4.c）
+ * 铺满一屏，背景不透明、透明各测一次，报告每个字的耗时和相对1位点阵的倍数。
+ * 四种情况轮流跑 BENCH_REPEAT 遍，各取最快的一遍，去掉PC上中断、调度、变频带来的毛刺
+ *
+ * 编译、运行方法见 readme.md 的“性能测试”一节
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#include "bench_port.h"
+#include "akiegui.h"
+#include "akiegui_draw.h"
+#include "akiegui_blend.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_W         AkieGUI_LCD_WIDTH
+#define BENCH_H         AkieGUI_LCD_HEIGHT
+#define BENCH_REPEAT    500
+
+extern pFONT Bench_ASCII_8x16_AA4;
+
+static akiegui_color_t s_fb[BENCH_W * BENCH_H];
+
+static const char s_text[] = "The quick brown fox jumps over 0123456789";
+
+/* 画一屏文字，返回耗时，glyphs 带回字数 */
+static uint32_t run_pass(pFONT *font, uint8_t transparent, uint32_t overhead, uint32_t *glyphs) {
+    akiegui_color_t fg = akiegui_argb888_to_native(0x00FFFFFF);
+    akiegui_color_t bg = akiegui_argb888_to_native(0x00203040);
+    uint16_t per_line = (uint16_t)(BENCH_W / font->Width);
+    uint16_t len = (uint16_t)strlen(s_text);
+    if (len > per_line) len = per_line;
+    char line[64];
+    memcpy(line, s_text, len);
+    line[len] = '\0';
+
+    uint16_t lines = (uint16_t)(BENCH_H / font->Height);
+    memset(s_fb, 0x40, sizeof(s_fb));
+    uint32_t t0 = bench_now();
+    for (uint16_t i = 0; i < lines; i++) {
+        akiegui_draw_string(s_fb, 0, (uint16_t)(i * font->Height), line, fg, bg, transparent, font);
+    }
+    uint32_t dt = bench_now() - t0;
+    *glyphs = (uint32_t)lines * len;
+    return (dt > overhead) ? dt - overhead : 0;
+}
+
+int main(void) {
+    static const char *mode[2] = { "opaque", "transparent" };
+    pFONT *font[2] = { &ASCII_8x16, &Bench_ASCII_8x16_AA4 };
+    uint32_t best[2][2], glyphs[2][2];
+
+    bench_timer_init();
+    g_akiegui.fb_width = BENCH_W;
+    g_akiegui.fb_height = BENCH_H;
+    g_akiegui.fb_bpp = AkieGUI_LCD_BPP;
+    g_akiegui.screen_width = BENCH_W;
+    g_akiegui.screen_height = BENCH_H;
+    g_akiegui.draw_opa = AKIEGUI_OPA_COVER;
+    g_akiegui.fb1 = (uint8_t*)s_fb;
+    g_akiegui.draw_fb = s_fb;
+
+    /* 四种情况轮流跑，各自取最快的一遍，让它们经历同样的频率、缓存状态 */
+    uint32_t overhead = bench_overhead();
+    memset(best, 0xFF, sizeof(best));
+    for (int r = 0; r < BENCH_REPEAT; r++) {
+        for (uint8_t t = 0; t < 2; t++) {
+            for (uint8_t f = 0; f < 2; f++) {
+                uint32_t dt = run_pass(font[f], t, overhead, &glyphs[t][f]);
+                if (dt < best[t][f]) best[t][f] = dt;
+            }
+        }
+    }
+
+    printf("%ux%u, %u bpp framebuffer, best of %u passes\n", BENCH_W, BENCH_H, AkieGUI_LCD_BPP, BENCH_REPEAT);
+    for (uint8_t t = 0; t < 2; t++) {
+        double g1 = (double)best[t][0] / glyphs[t][0];
+        double g4 = (double)best[t][1] / glyphs[t][1];
+        printf("%-11s 1bpp %7.1f  4bpp %7.1f %s/glyph  (4bpp = %.2fx)\n",
+               mode[t], g1, g4, BENCH_UNIT, g4 / g1);
+    }
+    return 0;
+}
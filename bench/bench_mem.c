@@ -0,0 +1,126 @@
+/* ============= bench_mem.c ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 内存分配器延迟测试：首次适应 vs TLSF
+ *
+ * 用同一条固定的分配/释放序列（伪随机，种子固定）跑 AkieGUI_MemAlloc / AkieGUI_MemFree，
+ * 逐次计时，报告每种操作的平均和最坏耗时。最坏耗时就是关中断时间的上界。
+ *   - 序列重复跑 BENCH_REPEAT 遍，每遍结束全部释放，内存池回到同一状态；
+ *     每一次操作取各遍里最小的耗时，去掉PC上中断、调度带来的毛刺
+ *   - 大小分布：70% 16~256字节（控件、字符串），25% 256~2K，5% 4K~16K（图片、缓冲）
+ *
+ * 编译、运行方法见 readme.md 的“性能测试”一节
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#include "bench_port.h"
+#include "akiegui_memory.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BENCH_POOL_SIZE   (256 * 1024)
+#define BENCH_SLOTS       128           /* 同时存在的块数上限 */
+#define BENCH_OPS         20000         /* 序列长度 */
+#define BENCH_REPEAT      20
+
+static uint8_t s_pool[BENCH_POOL_SIZE];
+
+static struct {
+    uint16_t slot;
+    uint32_t size;                      /* 0=释放这个槽 */
+} s_trace[BENCH_OPS];
+
+static uint32_t s_best[BENCH_OPS];      /* 每次操作各遍里最小的耗时 */
+static void *s_slot[BENCH_SLOTS];
+
+static uint32_t s_rng = 0x12345678u;
+static uint32_t rng(void) {
+    s_rng = s_rng * 1664525u + 1013904223u;
+    return s_rng >> 8;
+}
+
+static uint32_t rand_size(void) {
+    uint32_t r = rng() % 100;
+    if (r < 70) return 16 + rng() % 241;
+    if (r < 95) return 256 + rng() % 1793;
+    return 4096 + rng() % 12289;
+}
+
+/* 生成序列：槽空着就分配，占着就释放 */
+static void make_trace(void) {
+    uint8_t used[BENCH_SLOTS] = {0};
+    for (uint32_t i = 0; i < BENCH_OPS; i++) {
+        uint16_t k = (uint16_t)(rng() % BENCH_SLOTS);
+        s_trace[i].slot = k;
+        s_trace[i].size = used[k] ? 0 : rand_size();
+        used[k] = !used[k];
+    }
+}
+
+/* 跑一遍序列，返回分配失败次数 */
+static uint32_t run_trace(uint32_t overhead, AkieGUI_MemStat_T *stat) {
+    uint32_t fails = 0;
+    for (uint32_t i = 0; i < BENCH_OPS; i++) {
+        uint16_t k = s_trace[i].slot;
+        uint32_t t0, t1;
+        if (s_trace[i].size) {
+            t0 = bench_now();
+            s_slot[k] = AkieGUI_MemAlloc(s_trace[i].size);
+            t1 = bench_now();
+            if (!s_slot[k]) fails++;
+        } else {
+            t0 = bench_now();
+            AkieGUI_MemFree(s_slot[k]);
+            t1 = bench_now();
+            s_slot[k] = NULL;
+        }
+        uint32_t dt = t1 - t0;
+        dt = (dt > overhead) ? dt - overhead : 0;
+        if (dt < s_best[i]) s_best[i] = dt;
+    }
+    if (stat) AkieGUI_MemGetStat(stat);
+    for (uint32_t k = 0; k < BENCH_SLOTS; k++) {
+        AkieGUI_MemFree(s_slot[k]);
+        s_slot[k] = NULL;
+    }
+    return fails;
+}
+
+int main(void) {
+    AkieGUI_MemStat_T stat;
+    uint32_t fails = 0;
+
+    bench_timer_init();
+    if (AkieGUI_MemInit(s_pool, sizeof(s_pool)) != 0) {
+        printf("MemInit failed\n");
+        return 1;
+    }
+    make_trace();
+    memset(s_best, 0xFF, sizeof(s_best));
+    uint32_t overhead = bench_overhead();
+
+    for (int r = 0; r < BENCH_REPEAT; r++) {
+        fails = run_trace(overhead, r == 0 ? &stat : NULL);
+    }
+
+    uint64_t sum[2] = {0, 0};
+    uint32_t cnt[2] = {0, 0}, worst[2] = {0, 0};
+    for (uint32_t i = 0; i < BENCH_OPS; i++) {
+        int op = s_trace[i].size ? 0 : 1;
+        sum[op] += s_best[i];
+        cnt[op]++;
+        if (s_best[i] > worst[op]) worst[op] = s_best[i];
+    }
+
+    printf("allocator: %s\n", AkieGUI_MEM_ALLOCATOR == AkieGUI_MEM_TLSF ? "TLSF" : "first-fit");
+    printf("ops: %u alloc, %u free, %u alloc failed\n", cnt[0], cnt[1], fails);
+    printf("at end of trace: %u free blocks, largest %u bytes, frag %u%%\n",
+           stat.free_blocks, stat.largest_free, stat.frag);
+    printf("alloc: avg %6.1f  worst %6u %s\n", cnt[0] ? (double)sum[0] / cnt[0] : 0.0, worst[0], BENCH_UNIT);
+    printf("free:  avg %6.1f  worst %6u %s\n", cnt[1] ? (double)sum[1] / cnt[1] : 0.0, worst[1], BENCH_UNIT);
+    return 0;
+}
@@ -0,0 +1,70 @@
+/* ============= bench_port.h ============= */
+/*
+ * AkieGUI - 嵌入式极简图形库
+ * Copyright (C) 2026 雪琳Sherlyn (Xuelin-Sherlyn)
+ *
+ * 性能测试程序的移植层（编译库源文件时用 -include bench/bench_port.h 放在最前面）
+ *
+ *   - PC 上：关中断相关的宏都是空操作
+ *   - 计时：Cortex-M 用 DWT 周期计数器，x86 用 TSC，其它平台用纳秒
+ *
+ * 许可证: AGPL v3 (看许可证文件)
+ * 联系方式: xuelin-sherlyn@outlook.com
+ * B站: https://space.bilibili.com/1815675515
+ */
+#ifndef __BENCH_PORT_H__
+#define __BENCH_PORT_H__
+
+#include <stdint.h>
+
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_8M_MAIN__)
+    /* 上机：中断宏由 akiegui_port.h 提供 */
+    #include "stm32h7xx.h"
+    #define BENCH_UNIT "cycles"
+
+    static inline void bench_timer_init(void) {
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CYCCNT = 0;
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    }
+    static inline uint32_t bench_now(void) { return DWT->CYCCNT; }
+
+#else
+    /* PC：没有中断可关 */
+    #ifndef AkieGUI_DISABLE_IRQ
+    static inline uint32_t bench_primask(void) { return 0; }
+    #define AkieGUI_GET_PRIMASK()   bench_primask()
+    #define AkieGUI_SET_PRIMASK(x)  ((void)(x))
+    #define AkieGUI_DISABLE_IRQ()   ((void)0)
+    #define AkieGUI_ENABLE_IRQ()    ((void)0)
+    #endif
+
+    static inline void bench_timer_init(void) {}
+
+    #if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define BENCH_UNIT "cycles"
+    static inline uint32_t bench_now(void) { return (uint32_t)__rdtsc(); }
+    #else
+    #include <time.h>
+    #define BENCH_UNIT "ns"
+    static inline uint32_t bench_now(void) {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (uint32_t)((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+    }
+    #endif
+#endif
+
+/* 两次读计时器之间的固有开销（测量结果里要减掉）*/
+static inline uint32_t bench_overhead(void) {
+    uint32_t best = 0xFFFFFFFFu;
+    for (int i = 0; i < 1000; i++) {
+        uint32_t t0 = bench_now();
+        uint32_t t1 = bench_now();
+        if (t1 - t0 < best) best = t1 - t0;
+    }
+    return best;
+}
+
+#endif